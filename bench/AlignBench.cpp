@@ -0,0 +1,90 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgFormatter.h>
+
+#include <cstring>
+
+namespace {
+
+	// The output is started over once it reaches this size (keeping its capacity) so the rows measure the field writes rather than
+	// the string's reallocations
+	constexpr size_t outputLimit { 1 << 20 };
+
+	// How aligned fields used to be written: the value is rendered, the whole field is staged in a fill buffer and then copied into the output
+	af_bench::BenchResult BenchStaged(std::string name, size_t width, size_t rows) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		std::vector<char> fillBuffer;
+		fillBuffer.reserve(256);
+		std::string value;
+		af_bench::Stopwatch timer;
+		for( size_t i { 0 }; i < rows; ++i ) {
+				value.clear();
+				formatter::format_to(std::back_inserter(value), "{}", i);
+				if( width > fillBuffer.capacity() ) fillBuffer.reserve(width);
+				fillBuffer.resize(width);
+				std::memset(fillBuffer.data(), '_', width);
+				std::memcpy(fillBuffer.data() + width - value.size(), value.data(), value.size());
+				out.append(fillBuffer.data(), width);
+				if( out.size() >= outputLimit ) {
+						result.bytes += out.size();
+						out.clear();
+				}
+			}
+		result.seconds = timer.Elapsed();
+		result.bytes += out.size();
+		result.rows    = rows;
+		return result;
+	}
+
+	af_bench::BenchResult BenchFormat(std::string name, std::string fmt, size_t rows) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		af_bench::Stopwatch timer;
+		for( size_t i { 0 }; i < rows; ++i ) {
+				formatter::format_to(std::back_inserter(out), std::string_view(fmt), i);
+				if( out.size() >= outputLimit ) {
+						result.bytes += out.size();
+						out.clear();
+				}
+			}
+		result.seconds = timer.Elapsed();
+		result.bytes += out.size();
+		result.rows    = rows;
+		return result;
+	}
+
+	af_bench::BenchResult BenchInPlace(std::string name, std::string_view fill, size_t width, size_t rows) {
+		return BenchFormat(std::move(name), "{:" + std::string(fill) + ">" + std::to_string(width) + "}", rows);
+	}
+
+}    // namespace
+
+void af_bench::RunAlignBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	reporter.RowsSection("Alignment: Right-Aligned Integer Fields, Staged Copy vs In Place");
+	for( size_t width: { 8, 32, 128, 512, 1024, 4096 } ) {
+			// keep the amount of output roughly the same across widths
+			auto rows { std::max(size_t { 1 }, options.messages * 64 / width) };
+			reporter.ReportRows(BenchStaged("width " + std::to_string(width) + ": staged copy", width, rows));
+			reporter.ReportRows(BenchInPlace("width " + std::to_string(width) + ": in place", "_", width, rows));
+			// a three byte fill writes three times the bytes through the pattern fill instead of memset
+			reporter.ReportRows(BenchInPlace("width " + std::to_string(width) + ": in place, box-drawing fill", "\xE2\x94\x80", width, rows));
+		}
+
+	// fixed-width ids and counters: the '0' flag writes the padded digits straight into the output, a '0' fill goes through the
+	// general alignment path and a space fill is there for reference
+	reporter.RowsSection("Alignment: Zero-Padded Integer Fields");
+	struct ZeroPadCase
+	{
+		std::string_view zeroFlag;
+		std::string_view zeroFill;
+		std::string_view spaceFill;
+	};
+	for( auto [ zeroFlag, zeroFill, spaceFill ]: { ZeroPadCase { "{:08}", "{:0>8}", "{:>8}" }, ZeroPadCase { "{:016x}", "{:0>16x}", "{:>16x}" },
+	                                               ZeroPadCase { "{:+012}", "{:0>+12}", "{:>+12}" }, ZeroPadCase { "{:032b}", "{:0>32b}", "{:>32b}" } } )
+		{
+			reporter.ReportRows(BenchFormat(std::string(zeroFlag) + ": '0' flag", std::string(zeroFlag), options.messages));
+			reporter.ReportRows(BenchFormat(std::string(zeroFlag) + ": '0' fill", std::string(zeroFill), options.messages));
+			reporter.ReportRows(BenchFormat(std::string(zeroFlag) + ": ' ' fill", std::string(spaceFill), options.messages));
+		}
+}
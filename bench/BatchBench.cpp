@@ -0,0 +1,101 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgBatch.h>
+
+#include <memory>
+#include <thread>
+
+using namespace formatter::arg_formatter;
+
+namespace {
+
+	// The same CSV export row used by the sink benchmarks
+	constexpr std::string_view rowFormat { "{},{},{:.4f},{},{:x}\n" };
+	constexpr std::string_view rowLabel { "sensor-reading" };
+	using Row = std::tuple<size_t, std::string_view, double, bool, size_t>;
+
+	std::vector<Row> MakeRows(size_t count) {
+		std::vector<Row> rows;
+		rows.reserve(count);
+		for( size_t row { 0 }; row < count; ++row ) {
+				rows.emplace_back(row, rowLabel, static_cast<double>(row) * 0.3125, row % 2 == 0, row);
+			}
+		return rows;
+	}
+
+	af_bench::BenchResult BenchRowLoop(const std::vector<Row>& rows) {
+		af_bench::BenchResult result { "format_to per row (1 thread)" };
+		ArgFormatter formatter;
+		af_bench::Stopwatch timer;
+		std::string out;
+		for( auto& [ id, label, value, flag, checksum ]: rows ) formatter.format_to(std::back_inserter(out), rowFormat, id, label, value, flag, checksum);
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size();
+		result.rows    = rows.size();
+		return result;
+	}
+
+	af_bench::BenchResult BenchRowsTo(const std::vector<Row>& rows) {
+		af_bench::BenchResult result { "format_rows_to (parse once)" };
+		ArgFormatter formatter;
+		af_bench::Stopwatch timer;
+		std::string out;
+		formatter.format_rows_to(std::back_inserter(out), rowFormat, rows);
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size();
+		result.rows    = rows.size();
+		return result;
+	}
+
+	af_bench::BenchResult BenchColumnsTo(const std::vector<Row>& rows) {
+		std::vector<size_t> ids, checksums;
+		std::vector<std::string_view> labels;
+		std::vector<double> values;
+		auto flags { std::make_unique<bool[]>(rows.size()) };
+		for( auto& [ id, label, value, flag, checksum ]: rows ) {
+				ids.push_back(id);
+				labels.push_back(label);
+				values.push_back(value);
+				flags[ ids.size() - 1 ] = flag;
+				checksums.push_back(checksum);
+			}
+		// std::vector<bool> hands out proxies rather than bools, so the flags column is a plain array instead
+		std::span<const bool> boolFlags(flags.get(), rows.size());
+		af_bench::BenchResult result { "format_columns_to (parse once)" };
+		ArgFormatter formatter;
+		af_bench::Stopwatch timer;
+		std::string out;
+		formatter.format_columns_to(std::back_inserter(out), rowFormat, ids, labels, values, boolFlags, checksums);
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size();
+		result.rows    = rows.size();
+		return result;
+	}
+
+	af_bench::BenchResult BenchBatch(const std::vector<Row>& rows, size_t threads) {
+		af_bench::BenchResult result { "format_batch (" + std::to_string(threads) + (threads == 1 ? " thread)" : " threads)") };
+		af_bench::Stopwatch timer;
+		auto out { formatter::format_batch(rowFormat, rows, threads) };
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size();
+		result.rows    = rows.size();
+		return result;
+	}
+
+}    // namespace
+
+void af_bench::RunBatchBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	auto rows { MakeRows(options.rows) };
+	reporter.RowsSection("Batch Formatting: Per-Call Loop vs Parse Once (Single Thread)");
+	reporter.ReportRows(BenchRowLoop(rows));
+	reporter.ReportRows(BenchRowsTo(rows));
+	reporter.ReportRows(BenchColumnsTo(rows));
+
+	reporter.RowsSection("Batch Formatting Scaling Across Cores");
+	reporter.ReportRows(BenchRowLoop(rows));
+	auto cores { std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t { 1 }) };
+	for( size_t threads { 1 }; threads < cores; threads *= 2 ) {
+			reporter.ReportRows(BenchBatch(rows, threads));
+		}
+	reporter.ReportRows(BenchBatch(rows, cores));
+}
@@ -0,0 +1,368 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <locale>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#elif defined(__linux__)
+	#include <sched.h>
+#endif
+
+namespace af_bench {
+
+	struct BenchOptions
+	{
+		size_t rows { 2'000'000 };
+		size_t messages { 1'000'000 };
+		std::filesystem::path outputDir { std::filesystem::temp_directory_path() };
+		// where the results are also written as machine-readable CSV/JSON (left empty to skip)
+		std::filesystem::path csvPath {};
+		std::filesystem::path jsonPath {};
+		// the core the benchmarks are pinned to (-1 leaves scheduling alone)
+		int pinCore { -1 };
+	};
+
+	struct BenchResult
+	{
+		std::string name;
+		double seconds { 0.0 };
+		size_t bytes { 0 };
+		size_t rows { 0 };
+		// the section the result was reported under, filled in by BenchReporter
+		std::string section {};
+	};
+
+	// HDR-style log-bucket histogram of nanosecond latencies: values below 64 are counted exactly and every power of two above that is split into 32
+	// linear sub-buckets, so any recorded value is reported to within ~3% in a fixed 15KB table no matter how many samples there are
+	class LatencyHistogram
+	{
+	  public:
+		void Record(uint64_t ns) {
+			++counts[ BucketIndex(ns) ];
+			++count;
+			max = std::max(max, ns);
+		}
+		void Merge(const LatencyHistogram& other) {
+			for( size_t i { 0 }; i < bucketCount; ++i ) counts[ i ] += other.counts[ i ];
+			count += other.count;
+			max = std::max(max, other.max);
+		}
+		// The highest value that falls in the same bucket as the sample at 'p' (0.0 - 1.0), capped at the largest value recorded
+		uint64_t Percentile(double p) const {
+			if( count == 0 ) return 0;
+			auto rank { std::max(uint64_t { 1 }, static_cast<uint64_t>(p * static_cast<double>(count) + 0.5)) };
+			uint64_t seen { 0 };
+			for( size_t i { 0 }; i < bucketCount; ++i ) {
+					seen += counts[ i ];
+					if( seen >= rank ) return std::min(BucketUpperBound(i), max);
+				}
+			return max;
+		}
+		uint64_t Max() const {
+			return max;
+		}
+		uint64_t Count() const {
+			return count;
+		}
+
+	  private:
+		static constexpr unsigned subBucketBits { 5 };
+		static constexpr uint64_t subBucketCount { uint64_t { 1 } << subBucketBits };
+		// the exact buckets below 2 * subBucketCount, then subBucketCount buckets for each remaining power of two
+		static constexpr size_t bucketCount { (64 - subBucketBits) * subBucketCount };
+
+		static size_t BucketIndex(uint64_t ns) {
+			if( ns < 2 * subBucketCount ) return static_cast<size_t>(ns);
+			auto shift { static_cast<unsigned>(std::bit_width(ns)) - subBucketBits - 1 };
+			return static_cast<size_t>((shift + 1) * subBucketCount + ((ns >> shift) - subBucketCount));
+		}
+		static uint64_t BucketUpperBound(size_t index) {
+			if( index < 2 * subBucketCount ) return index;
+			auto shift { static_cast<unsigned>(index / subBucketCount) - 1 };
+			auto subBucket { index % subBucketCount + subBucketCount };
+			return ((subBucket + 1) << shift) - 1;
+		}
+
+	  private:
+		std::array<uint64_t, bucketCount> counts {};
+		uint64_t count { 0 };
+		uint64_t max { 0 };
+	};
+
+	// Per-call latencies in nanoseconds. The first call of a scenario (the cold call: empty buffers, untouched facets and tables) is kept apart
+	// from the steady state calls that make up the histogram
+	struct LatencyResult
+	{
+		std::string name;
+		LatencyHistogram histogram {};
+		uint64_t coldNs { 0 };
+		bool hasCold { false };
+		// the section the result was reported under, filled in by BenchReporter
+		std::string section {};
+
+		void Record(uint64_t ns) {
+			if( !hasCold ) {
+					coldNs  = ns;
+					hasCold = true;
+			} else {
+					histogram.Record(ns);
+				}
+		}
+		// Folds in a result measured on another thread; the slowest of the cold calls is kept
+		void Merge(const LatencyResult& other) {
+			histogram.Merge(other.histogram);
+			if( other.hasCold ) {
+					coldNs  = hasCold ? std::max(coldNs, other.coldNs) : other.coldNs;
+					hasCold = true;
+			}
+		}
+	};
+
+	// Fixed German-style separators so the localized benchmarks don't depend on which named locales happen to be installed
+	struct bench_numpunct: std::numpunct<char>
+	{
+		char do_thousands_sep() const override {
+			return '.';
+		}
+		char do_decimal_point() const override {
+			return ',';
+		}
+		std::string do_grouping() const override {
+			return "\3";
+		}
+	};
+
+	inline std::locale GroupingLocale() {
+		return std::locale(std::locale::classic(), new bench_numpunct);
+	}
+
+	// Pins the calling thread to 'core' so the measurements aren't skewed by migrations; threads started afterwards inherit it on Linux
+	inline bool PinToCore(int core) {
+#if defined(_WIN32)
+		return core >= 0 && core < 64 && SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR { 1 } << core) != 0;
+#elif defined(__linux__)
+		if( core < 0 || core >= CPU_SETSIZE ) return false;
+		cpu_set_t cores;
+		CPU_ZERO(&cores);
+		CPU_SET(core, &cores);
+		return sched_setaffinity(0, sizeof(cores), &cores) == 0;
+#else
+		return false;
+#endif
+	}
+
+	inline uint64_t NowNs() {
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	class Stopwatch
+	{
+	  public:
+		Stopwatch(): start(std::chrono::steady_clock::now()) { }
+		double Elapsed() const {
+			return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+
+	  private:
+		std::chrono::steady_clock::time_point start;
+	};
+
+	class BenchReporter
+	{
+	  public:
+		void Section(std::string_view title) {
+			section = title;
+			std::printf("\n%.*s\n", static_cast<int>(title.size()), title.data());
+			std::printf("%-40s %12s %12s %12s\n", "Benchmark", "Time (ms)", "Size (MB)", "MB/s");
+		}
+		void Report(const BenchResult& result) {
+			auto megabytes { static_cast<double>(result.bytes) / 1'000'000.0 };
+			std::printf("%-40s %12.2f %12.2f %12.2f\n", result.name.c_str(), result.seconds * 1000.0, megabytes,
+			            result.seconds > 0.0 ? megabytes / result.seconds : 0.0);
+			Record(result);
+		}
+		void RowsSection(std::string_view title) {
+			section = title;
+			std::printf("\n%.*s\n", static_cast<int>(title.size()), title.data());
+			std::printf("%-40s %12s %12s %14s %12s\n", "Benchmark", "Time (ms)", "Rows", "Rows/s", "MB/s");
+		}
+		void ReportRows(const BenchResult& result) {
+			auto megabytes { static_cast<double>(result.bytes) / 1'000'000.0 };
+			auto perSecond { [ &result ](double amount) { return result.seconds > 0.0 ? amount / result.seconds : 0.0; } };
+			std::printf("%-40s %12.2f %12zu %14.0f %12.2f\n", result.name.c_str(), result.seconds * 1000.0, result.rows,
+			            perSecond(static_cast<double>(result.rows)), perSecond(megabytes));
+			Record(result);
+		}
+		// One row per operation: ns/op, MB/s and the time relative to 'baseline' (the first result of a comparison group, reported as 1.00x)
+		void OpsSection(std::string_view title) {
+			section = title;
+			std::printf("\n%.*s\n", static_cast<int>(title.size()), title.data());
+			std::printf("%-56s %12s %12s %10s\n", "Benchmark", "ns/op", "MB/s", "Relative");
+		}
+		void ReportOps(const BenchResult& result, const BenchResult& baseline) {
+			auto relative { baseline.seconds > 0.0 && baseline.rows != 0 ? NsPerOp(result) / NsPerOp(baseline) : 0.0 };
+			std::printf("%-56s %12.2f %12.2f %9.2fx\n", result.name.c_str(), NsPerOp(result), MegabytesPerSecond(result), relative);
+			Record(result);
+		}
+		void LatencySection(std::string_view title) {
+			section = title;
+			std::printf("\n%.*s\n", static_cast<int>(title.size()), title.data());
+			std::printf("%-40s %10s %10s %10s %10s %10s %10s %12s\n", "Benchmark", "cold (ns)", "p50 (ns)", "p90 (ns)", "p99 (ns)", "p99.9 (ns)",
+			            "max (ns)", "Samples");
+		}
+		void ReportLatency(const LatencyResult& result) {
+			if( !result.hasCold ) return;
+			auto& histogram { result.histogram };
+			std::printf("%-40s %10llu %10llu %10llu %10llu %10llu %10llu %12llu\n", result.name.c_str(), static_cast<unsigned long long>(result.coldNs),
+			            static_cast<unsigned long long>(histogram.Percentile(0.50)), static_cast<unsigned long long>(histogram.Percentile(0.90)),
+			            static_cast<unsigned long long>(histogram.Percentile(0.99)), static_cast<unsigned long long>(histogram.Percentile(0.999)),
+			            static_cast<unsigned long long>(histogram.Max()), static_cast<unsigned long long>(histogram.Count()));
+			latencies.push_back(result);
+			latencies.back().section = section;
+		}
+		const std::vector<BenchResult>& Results() const {
+			return results;
+		}
+
+		static double NsPerOp(const BenchResult& result) {
+			return result.rows != 0 ? result.seconds * 1e9 / static_cast<double>(result.rows) : 0.0;
+		}
+		static double MegabytesPerSecond(const BenchResult& result) {
+			return result.seconds > 0.0 ? static_cast<double>(result.bytes) / 1'000'000.0 / result.seconds : 0.0;
+		}
+
+		const std::vector<LatencyResult>& Latencies() const {
+			return latencies;
+		}
+
+		// One table for both kinds of results: a throughput result fills section through mb_per_s (ns_per_op is left empty without rows) and a
+		// latency result fills section, name, rows (its sample count) and cold_ns through max_ns
+		bool WriteCsv(const std::filesystem::path& path) const {
+			auto file { std::fopen(path.string().c_str(), "w") };
+			if( file == nullptr ) return false;
+			auto csvField { [ file ](std::string_view field) {
+				std::fputc('"', file);
+				for( auto ch: field ) {
+						if( ch == '"' ) std::fputc('"', file);
+						std::fputc(ch, file);
+					}
+				std::fputc('"', file);
+			} };
+			std::fputs("section,name,seconds,bytes,rows,ns_per_op,mb_per_s,cold_ns,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n", file);
+			for( auto& result: results ) {
+					csvField(result.section);
+					std::fputc(',', file);
+					csvField(result.name);
+					std::fprintf(file, ",%.9f,%zu,%zu,", result.seconds, result.bytes, result.rows);
+					if( result.rows != 0 ) std::fprintf(file, "%.3f", NsPerOp(result));
+					std::fprintf(file, ",%.3f,,,,,,\n", MegabytesPerSecond(result));
+				}
+			for( auto& result: latencies ) {
+					csvField(result.section);
+					std::fputc(',', file);
+					csvField(result.name);
+					auto [ p50, p90, p99, p999 ] { Percentiles(result.histogram) };
+					std::fprintf(file, ",,,%llu,,,%llu,%llu,%llu,%llu,%llu,%llu\n", static_cast<unsigned long long>(result.histogram.Count()),
+					             static_cast<unsigned long long>(result.coldNs), p50, p90, p99, p999, static_cast<unsigned long long>(result.histogram.Max()));
+				}
+			return std::fclose(file) == 0;
+		}
+
+		// { "results": [ { "section", "name", "seconds", "bytes", "rows", "ns_per_op", "mb_per_s" }, ... ] (ns_per_op is null without rows),
+		//   "latency": [ { "section", "name", "samples", "cold_ns", "p50_ns", "p90_ns", "p99_ns", "p999_ns", "max_ns" }, ... ] }
+		bool WriteJson(const std::filesystem::path& path) const {
+			auto file { std::fopen(path.string().c_str(), "w") };
+			if( file == nullptr ) return false;
+			auto jsonString { [ file ](std::string_view str) {
+				std::fputc('"', file);
+				for( auto ch: str ) {
+						if( ch == '"' || ch == '\\' ) {
+								std::fputc('\\', file);
+								std::fputc(ch, file);
+						} else if( static_cast<unsigned char>(ch) < 0x20 ) {
+								std::fprintf(file, "\\u%04x", static_cast<unsigned>(ch));
+						} else {
+								std::fputc(ch, file);
+							}
+					}
+				std::fputc('"', file);
+			} };
+			auto startEntry { [ & ](bool first, std::string_view entrySection, std::string_view name) {
+				std::fputs(first ? "\n    { \"section\": " : ",\n    { \"section\": ", file);
+				jsonString(entrySection);
+				std::fputs(", \"name\": ", file);
+				jsonString(name);
+			} };
+			std::fputs("{\n  \"results\": [", file);
+			for( size_t i { 0 }; i < results.size(); ++i ) {
+					auto& result { results[ i ] };
+					startEntry(i == 0, result.section, result.name);
+					std::fprintf(file, ", \"seconds\": %.9f, \"bytes\": %zu, \"rows\": %zu, \"ns_per_op\": ", result.seconds, result.bytes, result.rows);
+					if( result.rows != 0 ) {
+							std::fprintf(file, "%.3f", NsPerOp(result));
+					} else {
+							std::fputs("null", file);
+						}
+					std::fprintf(file, ", \"mb_per_s\": %.3f }", MegabytesPerSecond(result));
+				}
+			std::fputs("\n  ],\n  \"latency\": [", file);
+			for( size_t i { 0 }; i < latencies.size(); ++i ) {
+					auto& result { latencies[ i ] };
+					startEntry(i == 0, result.section, result.name);
+					auto [ p50, p90, p99, p999 ] { Percentiles(result.histogram) };
+					std::fprintf(file,
+					             ", \"samples\": %llu, \"cold_ns\": %llu, \"p50_ns\": %llu, \"p90_ns\": %llu, \"p99_ns\": %llu, \"p999_ns\": %llu, \"max_ns\": %llu }",
+					             static_cast<unsigned long long>(result.histogram.Count()), static_cast<unsigned long long>(result.coldNs), p50, p90, p99, p999,
+					             static_cast<unsigned long long>(result.histogram.Max()));
+				}
+			std::fputs("\n  ]\n}\n", file);
+			return std::fclose(file) == 0;
+		}
+
+	  private:
+		static std::array<unsigned long long, 4> Percentiles(const LatencyHistogram& histogram) {
+			return { histogram.Percentile(0.50), histogram.Percentile(0.90), histogram.Percentile(0.99), histogram.Percentile(0.999) };
+		}
+		void Record(const BenchResult& result) {
+			results.push_back(result);
+			results.back().section = section;
+		}
+
+	  private:
+		std::string section;
+		std::vector<BenchResult> results;
+		std::vector<LatencyResult> latencies;
+	};
+
+	// Each benchmark group lives in its own translation unit and is registered here
+	void RunSinkBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunSinkLatencyBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunRecordBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunBatchBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunRangeBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunEscapeBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunTranscodeBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunAlignBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunIntegerBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunFloatBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunErrorBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunComparisonBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+	void RunLatencyBenchmarks(const BenchOptions& options, BenchReporter& reporter);
+
+}    // namespace af_bench
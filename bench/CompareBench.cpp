@@ -0,0 +1,492 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgFormatter.h>
+
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <random>
+#include <sstream>
+
+#if __has_include(<format>)
+	#include <format>
+#endif
+#if defined(__cpp_lib_format)
+	#define AF_BENCH_STD_FORMAT
+#endif
+
+namespace {
+
+	// A user type formatted through its CustomFormatter, with a std::formatter specialization that writes the same text for the std::format side
+	struct BenchPoint
+	{
+		int x;
+		int y;
+	};
+
+}    // namespace
+
+template<> struct formatter::CustomFormatter<BenchPoint>
+{
+	constexpr void Parse(std::string_view) { }
+	template<typename resultCtx> constexpr auto Format(const BenchPoint& point, resultCtx& ctx) const {
+		formatter::format_to(std::back_inserter(ctx), "({}, {})", point.x, point.y);
+	}
+};
+
+#if defined(AF_BENCH_STD_FORMAT)
+template<> struct std::formatter<BenchPoint>
+{
+	constexpr auto parse(std::format_parse_context& ctx) {
+		return ctx.begin();
+	}
+	auto format(const BenchPoint& point, std::format_context& ctx) const {
+		return std::format_to(ctx.out(), "({}, {})", point.x, point.y);
+	}
+};
+#endif
+
+namespace {
+
+	// The output is started over once it reaches this size (keeping its capacity) so the rows measure the formatting calls rather than the string's
+	// reallocations
+	constexpr size_t outputLimit { 1 << 20 };
+	// The values are cycled through from a small table so that they stay in cache and can't be folded into the loop
+	constexpr size_t valueCount { 1024 };
+
+	template<typename Write> af_bench::BenchResult BenchCalls(std::string name, size_t calls, Write&& write) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		out.reserve(outputLimit + 4096);
+		af_bench::Stopwatch timer;
+		for( size_t i { 0 }; i < calls; ++i ) {
+				write(out, i % valueCount);
+				if( out.size() >= outputLimit ) {
+						result.bytes += out.size();
+						out.clear();
+				}
+			}
+		result.seconds = timer.Elapsed();
+		result.bytes += out.size();
+		result.rows = calls;
+		return result;
+	}
+
+	// The same output written four ways: 'spec' is shared by ArgFormatter and std::format while 'printfSpec' and 'stream' are the closest snprintf()
+	// (strftime() for std::tm) and std::ostringstream equivalents, left empty when there isn't one
+	template<typename T> struct CompareCase
+	{
+		std::string_view spec;
+		const char* printfSpec;
+		void (*stream)(std::ostream& os, const T& value);
+	};
+
+	template<typename T> size_t WritePrintf(char* buffer, size_t size, const char* spec, const T& value) {
+		int written { 0 };
+		if constexpr( std::is_same_v<T, std::tm> ) {
+				return std::strftime(buffer, size, spec, &value);
+		} else if constexpr( std::is_same_v<T, std::string> ) {
+				written = std::snprintf(buffer, size, spec, value.c_str());
+		} else if constexpr( std::is_same_v<T, std::string_view> ) {
+				written = std::snprintf(buffer, size, spec, static_cast<int>(value.size()), value.data());
+		} else {
+				written = std::snprintf(buffer, size, spec, value);
+			}
+		return std::min(static_cast<size_t>(std::max(written, 0)), size - 1);
+	}
+
+	template<typename T>
+	void RunCase(af_bench::BenchReporter& reporter, size_t calls, std::string_view typeName, const std::vector<T>& values, const CompareCase<T>& test) {
+		auto label { std::string(typeName) + " " + std::string(test.spec) + ": " };
+		auto baseline { BenchCalls(label + "ArgFormatter", calls, [ & ](std::string& out, size_t i) {
+			formatter::format_to(std::back_inserter(out), test.spec, values[ i ]);
+		}) };
+		reporter.ReportOps(baseline, baseline);
+#if defined(AF_BENCH_STD_FORMAT)
+		if constexpr( !std::is_same_v<T, std::tm> ) {
+				reporter.ReportOps(BenchCalls(label + "std::format", calls,
+				                              [ & ](std::string& out, size_t i) {
+													  // bound to a name first since make_format_args() only takes lvalues (and std::vector<bool> hands back prvalues)
+													  const T& value { values[ i ] };
+													  std::vformat_to(std::back_inserter(out), test.spec, std::make_format_args(value));
+												  }),
+				                   baseline);
+		}
+#endif
+		if( test.printfSpec != nullptr ) {
+				reporter.ReportOps(BenchCalls(label + (std::is_same_v<T, std::tm> ? "strftime" : "snprintf"), calls,
+				                              [ & ](std::string& out, size_t i) {
+													  char buffer[ 256 ];
+													  out.append(buffer, WritePrintf(buffer, sizeof(buffer), test.printfSpec, values[ i ]));
+												  }),
+				                   baseline);
+		}
+		if( test.stream != nullptr ) {
+				std::ostringstream os;
+				reporter.ReportOps(BenchCalls(label + "std::ostringstream", calls,
+				                              [ & ](std::string& out, size_t i) {
+													  os.str(std::string {});
+													  test.stream(os, values[ i ]);
+													  out.append(os.view());
+												  }),
+				                   baseline);
+		}
+	}
+
+	template<typename T> void RunCases(af_bench::BenchReporter& reporter, size_t calls, std::string_view typeName, const std::vector<T>& values,
+	                                   std::initializer_list<CompareCase<T>> cases) {
+		for( auto& test: cases ) RunCase(reporter, calls, typeName, values, test);
+	}
+
+	template<typename T, typename Make> std::vector<T> MakeValues(Make&& make) {
+		std::vector<T> values;
+		values.reserve(valueCount);
+		std::mt19937_64 rng { 17 };
+		for( size_t i { 0 }; i < valueCount; ++i ) values.push_back(make(rng, i));
+		return values;
+	}
+
+	// Magnitudes spread evenly over the digit counts rather than bunched up at the type's maximum
+	template<typename T> std::vector<T> MakeIntegers() {
+		return MakeValues<T>([](std::mt19937_64& rng, size_t i) {
+			auto digits { std::uniform_int_distribution<int> { 1, std::numeric_limits<T>::digits10 }(rng) };
+			auto value { static_cast<T>(rng() % static_cast<uint64_t>(std::pow(10.0, digits))) };
+			if constexpr( std::is_signed_v<T> ) {
+					return i % 2 == 0 ? value : static_cast<T>(-value);
+			} else {
+					return value;
+				}
+		});
+	}
+
+	template<typename T> std::vector<T> MakeFloats() {
+		return MakeValues<T>([](std::mt19937_64& rng, size_t i) {
+			auto value { std::pow(10.0, std::uniform_real_distribution<double> { -3.0, 6.0 }(rng)) };
+			return static_cast<T>(i % 2 == 0 ? value : -value);
+		});
+	}
+
+	std::vector<std::string> MakeStrings() {
+		return MakeValues<std::string>([](std::mt19937_64& rng, size_t) {
+			return std::string(std::uniform_int_distribution<size_t> { 4, 20 }(rng), static_cast<char>('a' + rng() % 26));
+		});
+	}
+
+	std::vector<std::tm> MakeTimes() {
+		return MakeValues<std::tm>([](std::mt19937_64& rng, size_t) {
+			std::tm time {};
+			time.tm_year = 100 + static_cast<int>(rng() % 40);
+			time.tm_mon  = static_cast<int>(rng() % 12);
+			time.tm_mday = 1 + static_cast<int>(rng() % 28);
+			time.tm_hour = static_cast<int>(rng() % 24);
+			time.tm_min  = static_cast<int>(rng() % 60);
+			time.tm_sec  = static_cast<int>(rng() % 60);
+			time.tm_wday = static_cast<int>(rng() % 7);
+			time.tm_yday = static_cast<int>(rng() % 365);
+			return time;
+		});
+	}
+
+	// A typical log line: several fields of different types and specs in one call
+	void RunMixedLine(af_bench::BenchReporter& reporter, size_t calls) {
+		auto names { MakeStrings() };
+		auto counts { MakeIntegers<int>() };
+		auto ratios { MakeFloats<double>() };
+		auto flags { MakeValues<bool>([](std::mt19937_64& rng, size_t) { return rng() % 2 == 0; }) };
+		constexpr std::string_view spec { "[{:<20}] count={:>8} ratio={:.3f} ok={}" };
+		std::string label { "log line, 4 fields: " };
+		auto baseline { BenchCalls(label + "ArgFormatter", calls, [ & ](std::string& out, size_t i) {
+			formatter::format_to(std::back_inserter(out), spec, names[ i ], counts[ i ], ratios[ i ], static_cast<bool>(flags[ i ]));
+		}) };
+		reporter.ReportOps(baseline, baseline);
+#if defined(AF_BENCH_STD_FORMAT)
+		reporter.ReportOps(BenchCalls(label + "std::format", calls,
+		                              [ & ](std::string& out, size_t i) {
+											  bool flag { flags[ i ] };
+											  std::vformat_to(std::back_inserter(out), spec, std::make_format_args(names[ i ], counts[ i ], ratios[ i ], flag));
+										  }),
+		                   baseline);
+#endif
+		reporter.ReportOps(BenchCalls(label + "snprintf", calls,
+		                              [ & ](std::string& out, size_t i) {
+											  char buffer[ 256 ];
+											  auto written { std::snprintf(buffer, sizeof(buffer), "[%-20s] count=%8d ratio=%.3f ok=%s", names[ i ].c_str(), counts[ i ],
+													                       ratios[ i ], flags[ i ] ? "true" : "false") };
+											  out.append(buffer, std::min(static_cast<size_t>(std::max(written, 0)), sizeof(buffer) - 1));
+										  }),
+		                   baseline);
+		std::ostringstream os;
+		reporter.ReportOps(BenchCalls(label + "std::ostringstream", calls,
+		                              [ & ](std::string& out, size_t i) {
+											  os.str(std::string {});
+											  os << '[' << std::left << std::setw(20) << names[ i ] << "] count=" << std::right << std::setw(8) << counts[ i ]
+												 << " ratio=" << std::fixed << std::setprecision(3) << ratios[ i ] << " ok=" << std::boolalpha
+												 << static_cast<bool>(flags[ i ]);
+											  out.append(os.view());
+										  }),
+		                   baseline);
+	}
+
+	// Printed in place of a row when a side has no equivalent for the case, so that the gap shows up in the table instead of the row just missing
+	void ReportSkipped(const std::string& name, const char* reason) {
+		std::printf("%-56s %12s   (%s)\n", name.c_str(), "skipped", reason);
+	}
+
+	void RunCustomType(af_bench::BenchReporter& reporter, size_t calls) {
+		auto points { MakeValues<BenchPoint>([](std::mt19937_64& rng, size_t) {
+			std::uniform_int_distribution<int> coordinate { -100'000, 100'000 };
+			return BenchPoint { coordinate(rng), coordinate(rng) };
+		}) };
+		std::string label { "BenchPoint {}: " };
+		auto baseline { BenchCalls(label + "ArgFormatter", calls, [ & ](std::string& out, size_t i) {
+			formatter::format_to(std::back_inserter(out), "{}", points[ i ]);
+		}) };
+		reporter.ReportOps(baseline, baseline);
+#if defined(AF_BENCH_STD_FORMAT)
+		reporter.ReportOps(BenchCalls(label + "std::format", calls,
+		                              [ & ](std::string& out, size_t i) {
+											  std::vformat_to(std::back_inserter(out), "{}", std::make_format_args(points[ i ]));
+										  }),
+		                   baseline);
+#endif
+		reporter.ReportOps(BenchCalls(label + "snprintf", calls,
+		                              [ & ](std::string& out, size_t i) {
+											  char buffer[ 64 ];
+											  auto written { std::snprintf(buffer, sizeof(buffer), "(%d, %d)", points[ i ].x, points[ i ].y) };
+											  out.append(buffer, std::min(static_cast<size_t>(std::max(written, 0)), sizeof(buffer) - 1));
+										  }),
+		                   baseline);
+		std::ostringstream os;
+		reporter.ReportOps(BenchCalls(label + "std::ostringstream", calls,
+		                              [ & ](std::string& out, size_t i) {
+											  os.str(std::string {});
+											  os << '(' << points[ i ].x << ", " << points[ i ].y << ')';
+											  out.append(os.view());
+										  }),
+		                   baseline);
+	}
+
+	// A field with no argument (std::monostate) that only writes its fill, like a rule line under a table header
+	void RunMonostate(af_bench::BenchReporter& reporter, size_t calls) {
+		constexpr std::string_view spec { "{:-<40}" };
+		auto label { "monostate " + std::string(spec) + ": " };
+		auto baseline { BenchCalls(label + "ArgFormatter", calls, [ & ](std::string& out, size_t) { formatter::format_to(std::back_inserter(out), spec); }) };
+		reporter.ReportOps(baseline, baseline);
+		// std::format throws for a replacement field without an argument, and snprintf() can only pad with spaces
+		ReportSkipped(label + "std::format", "no argument-less field");
+		ReportSkipped(label + "snprintf", "no fill character");
+		std::ostringstream os;
+		reporter.ReportOps(BenchCalls(label + "std::ostringstream", calls,
+		                              [ & ](std::string& out, size_t) {
+											  os.str(std::string {});
+											  os << std::setfill('-') << std::setw(40) << "";
+											  out.append(os.view());
+										  }),
+		                   baseline);
+	}
+
+	// Short vectors of ints, written element by element on the snprintf() and stream sides; 'base' is the stream's equivalent of the element spec
+	void RunRange(af_bench::BenchReporter& reporter, size_t calls, std::string_view spec, const char* printfSpec, std::ios_base& (*base)(std::ios_base&)) {
+		auto ranges { MakeValues<std::vector<int>>([](std::mt19937_64& rng, size_t) {
+			// kept positive since snprintf() and the streams write negative values in hex as their two's complement
+			std::uniform_int_distribution<int> element { 0, 1'000'000 };
+			std::vector<int> values(8);
+			for( auto& value: values ) value = element(rng);
+			return values;
+		}) };
+		auto label { "vector<int> (8) " + std::string(spec) + ": " };
+		auto baseline { BenchCalls(label + "ArgFormatter", calls, [ & ](std::string& out, size_t i) {
+			formatter::format_to(std::back_inserter(out), spec, ranges[ i ]);
+		}) };
+		reporter.ReportOps(baseline, baseline);
+#if defined(AF_BENCH_STD_FORMAT) && defined(__cpp_lib_format_ranges)
+		reporter.ReportOps(BenchCalls(label + "std::format", calls,
+		                              [ & ](std::string& out, size_t i) {
+											  std::vformat_to(std::back_inserter(out), spec, std::make_format_args(ranges[ i ]));
+										  }),
+		                   baseline);
+#else
+		// range formatting only came to std::format with C++23
+		ReportSkipped(label + "std::format", "no __cpp_lib_format_ranges");
+#endif
+		reporter.ReportOps(BenchCalls(label + "snprintf", calls,
+		                              [ & ](std::string& out, size_t i) {
+											  out += '[';
+											  for( size_t element { 0 }; element < ranges[ i ].size(); ++element ) {
+													  char buffer[ 32 ];
+													  if( element != 0 ) out += ", ";
+													  auto written { std::snprintf(buffer, sizeof(buffer), printfSpec, ranges[ i ][ element ]) };
+													  out.append(buffer, std::min(static_cast<size_t>(std::max(written, 0)), sizeof(buffer) - 1));
+												  }
+											  out += ']';
+										  }),
+		                   baseline);
+		std::ostringstream os;
+		reporter.ReportOps(BenchCalls(label + "std::ostringstream", calls,
+		                              [ & ](std::string& out, size_t i) {
+											  os.str(std::string {});
+											  os << base << '[';
+											  for( size_t element { 0 }; element < ranges[ i ].size(); ++element ) {
+													  os << (element == 0 ? "" : ", ") << ranges[ i ][ element ];
+												  }
+											  os << ']';
+											  out.append(os.view());
+										  }),
+		                   baseline);
+	}
+
+#if !defined(AF_NO_LOCALE)
+	template<typename T> void RunLocalizedCase(af_bench::BenchReporter& reporter, size_t calls, const std::locale& loc, std::string_view typeName,
+	                                          const std::vector<T>& values, std::string_view spec, void (*stream)(std::ostream& os, const T& value)) {
+		auto label { std::string(typeName) + " " + std::string(spec) + ": " };
+		auto baseline { BenchCalls(label + "ArgFormatter", calls, [ & ](std::string& out, size_t i) {
+			formatter::format_to(std::back_inserter(out), loc, spec, values[ i ]);
+		}) };
+		reporter.ReportOps(baseline, baseline);
+	#if defined(AF_BENCH_STD_FORMAT)
+		if constexpr( !std::is_same_v<T, std::tm> ) {
+				reporter.ReportOps(BenchCalls(label + "std::format", calls,
+				                              [ & ](std::string& out, size_t i) {
+													  const T& value { values[ i ] };
+													  std::vformat_to(std::back_inserter(out), loc, spec, std::make_format_args(value));
+												  }),
+				                   baseline);
+		}
+	#endif
+		// snprintf() only knows the global C locale, so there's nothing to compare against on that side
+		std::ostringstream os;
+		os.imbue(loc);
+		reporter.ReportOps(BenchCalls(label + "std::ostringstream", calls,
+		                              [ & ](std::string& out, size_t i) {
+											  os.str(std::string {});
+											  stream(os, values[ i ]);
+											  out.append(os.view());
+										  }),
+		                   baseline);
+	}
+#endif
+
+}    // namespace
+
+void af_bench::RunComparisonBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	auto calls { options.messages };
+
+	reporter.OpsSection("Comparison: Integers");
+	RunCases<int>(reporter, calls, "int", MakeIntegers<int>(),
+	              {
+					  { "{}", "%d", [](std::ostream& os, const int& v) { os << v; } },
+					  { "{:>10}", "%10d", [](std::ostream& os, const int& v) { os << std::setw(10) << v; } },
+					  { "{:+010}", "%+010d", [](std::ostream& os, const int& v) { os << std::showpos << std::internal << std::setfill('0') << std::setw(10) << v; } },
+				  });
+	RunCases<unsigned int>(reporter, calls, "unsigned int", MakeIntegers<unsigned int>(),
+	                       {
+							   { "{}", "%u", [](std::ostream& os, const unsigned int& v) { os << v; } },
+							   { "{:#x}", "%#x", [](std::ostream& os, const unsigned int& v) { os << std::showbase << std::hex << v; } },
+							   { "{:o}", "%o", [](std::ostream& os, const unsigned int& v) { os << std::oct << v; } },
+						   });
+	RunCases<long long>(reporter, calls, "long long", MakeIntegers<long long>(),
+	                    {
+							{ "{}", "%lld", [](std::ostream& os, const long long& v) { os << v; } },
+						});
+	RunCases<unsigned long long>(reporter, calls, "unsigned long long", MakeIntegers<unsigned long long>(),
+	                             {
+									 { "{}", "%llu", [](std::ostream& os, const unsigned long long& v) { os << v; } },
+									 { "{:016X}", "%016llX",
+									   [](std::ostream& os, const unsigned long long& v) { os << std::uppercase << std::hex << std::setfill('0') << std::setw(16) << v; } },
+									 // neither snprintf() nor the streams have a binary presentation
+									 { "{:b}", nullptr, nullptr },
+								 });
+
+	reporter.OpsSection("Comparison: Floating Point");
+	RunCases<float>(reporter, calls, "float", MakeFloats<float>(),
+	                {
+						{ "{:.3f}", "%.3f", [](std::ostream& os, const float& v) { os << std::fixed << std::setprecision(3) << v; } },
+					});
+	RunCases<double>(reporter, calls, "double", MakeFloats<double>(),
+	                 {
+						 { "{:.2f}", "%.2f", [](std::ostream& os, const double& v) { os << std::fixed << std::setprecision(2) << v; } },
+						 { "{:>12.2f}", "%12.2f", [](std::ostream& os, const double& v) { os << std::fixed << std::setprecision(2) << std::setw(12) << v; } },
+						 { "{:.6e}", "%.6e", [](std::ostream& os, const double& v) { os << std::scientific << std::setprecision(6) << v; } },
+						 { "{:g}", "%g", [](std::ostream& os, const double& v) { os << v; } },
+						 // the shortest round trip representation has no snprintf() or stream equivalent
+						 { "{}", nullptr, nullptr },
+					 });
+	RunCases<long double>(reporter, calls, "long double", MakeFloats<long double>(),
+	                      {
+							  { "{:.3f}", "%.3Lf", [](std::ostream& os, const long double& v) { os << std::fixed << std::setprecision(3) << v; } },
+						  });
+
+	reporter.OpsSection("Comparison: Strings, Characters, Booleans And Pointers");
+	auto strings { MakeStrings() };
+	RunCases<std::string>(reporter, calls, "std::string", strings,
+	                      {
+							  { "{}", "%s", [](std::ostream& os, const std::string& v) { os << v; } },
+							  { "{:<24}", "%-24s", [](std::ostream& os, const std::string& v) { os << std::left << std::setw(24) << v; } },
+							  { "{:*^24}", nullptr, nullptr },
+						  });
+	std::vector<std::string_view> views(strings.begin(), strings.end());
+	RunCases<std::string_view>(reporter, calls, "std::string_view", views,
+	                           {
+								   { "{}", "%.*s", [](std::ostream& os, const std::string_view& v) { os << v; } },
+								   { "{:>24}", "%24.*s", [](std::ostream& os, const std::string_view& v) { os << std::setw(24) << v; } },
+							   });
+	std::vector<const char*> pointers;
+	for( auto& str: strings ) pointers.push_back(str.c_str());
+	RunCases<const char*>(reporter, calls, "const char*", pointers,
+	                      {
+							  { "{}", "%s", [](std::ostream& os, const char* const& v) { os << v; } },
+						  });
+	RunCases<char>(reporter, calls, "char", MakeValues<char>([](std::mt19937_64& rng, size_t) { return static_cast<char>('!' + rng() % 94); }),
+	               {
+					   { "{}", "%c", [](std::ostream& os, const char& v) { os << v; } },
+					   { "{:>4}", "%4c", [](std::ostream& os, const char& v) { os << std::setw(4) << v; } },
+				   });
+	RunCases<bool>(reporter, calls, "bool", MakeValues<bool>([](std::mt19937_64& rng, size_t) { return rng() % 2 == 0; }),
+	               {
+					   // snprintf() has no textual boolean
+					   { "{}", nullptr, [](std::ostream& os, const bool& v) { os << std::boolalpha << v; } },
+				   });
+	auto addresses { MakeValues<const void*>([ &strings ](std::mt19937_64&, size_t i) { return static_cast<const void*>(strings[ i ].data()); }) };
+	RunCases<const void*>(reporter, calls, "const void*", addresses,
+	                      {
+							  { "{}", "%p", [](std::ostream& os, const void* const& v) { os << v; } },
+						  });
+	RunCases<void*>(reporter, calls, "void*", MakeValues<void*>([ &strings ](std::mt19937_64&, size_t i) { return static_cast<void*>(strings[ i ].data()); }),
+	                {
+						{ "{}", "%p", [](std::ostream& os, void* const& v) { os << v; } },
+					});
+
+	// std::format has no formatter for std::tm (only for the <chrono> types), so the time specs are compared against strftime() and std::put_time()
+	reporter.OpsSection("Comparison: Time Specs (std::tm)");
+	RunCases<std::tm>(reporter, calls, "std::tm", MakeTimes(),
+	                  {
+						  { "{:%Y-%m-%d %H:%M:%S}", "%Y-%m-%d %H:%M:%S", [](std::ostream& os, const std::tm& v) { os << std::put_time(&v, "%Y-%m-%d %H:%M:%S"); } },
+						  { "{:%F %T}", "%F %T", [](std::ostream& os, const std::tm& v) { os << std::put_time(&v, "%F %T"); } },
+						  { "{:%a %b %d %Y}", "%a %b %d %Y", [](std::ostream& os, const std::tm& v) { os << std::put_time(&v, "%a %b %d %Y"); } },
+						  { "{:%c}", "%c", [](std::ostream& os, const std::tm& v) { os << std::put_time(&v, "%c"); } },
+					  });
+
+	reporter.OpsSection("Comparison: Mixed Fields");
+	RunMixedLine(reporter, calls);
+
+	reporter.OpsSection("Comparison: Custom Types, Argument-less Fields And Ranges");
+	RunCustomType(reporter, calls);
+	RunMonostate(reporter, calls);
+	RunRange(reporter, calls, "{}", "%d", std::dec);
+	RunRange(reporter, calls, "{::x}", "%x", std::hex);
+
+#if !defined(AF_NO_LOCALE)
+	reporter.OpsSection("Comparison: Localized ('L') Formatting");
+	auto loc { GroupingLocale() };
+	RunLocalizedCase<int>(reporter, calls, loc, "int", MakeIntegers<int>(), "{:L}", [](std::ostream& os, const int& v) { os << v; });
+	RunLocalizedCase<long long>(reporter, calls, loc, "long long", MakeIntegers<long long>(), "{:>20L}", [](std::ostream& os, const long long& v) { os << std::setw(20) << v; });
+	RunLocalizedCase<double>(reporter, calls, loc, "double", MakeFloats<double>(), "{:.2Lf}",
+	                         [](std::ostream& os, const double& v) { os << std::fixed << std::setprecision(2) << v; });
+	RunLocalizedCase<bool>(reporter, calls, loc, "bool", MakeValues<bool>([](std::mt19937_64& rng, size_t) { return rng() % 2 == 0; }), "{:L}",
+	                       [](std::ostream& os, const bool& v) { os << std::boolalpha << v; });
+	RunLocalizedCase<std::tm>(reporter, calls, loc, "std::tm", MakeTimes(), "{:L%H:%M:%S}", [](std::ostream& os, const std::tm& v) { os << std::put_time(&v, "%H:%M:%S"); });
+#endif
+}
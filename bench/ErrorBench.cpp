@@ -0,0 +1,61 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgFormatter.h>
+
+namespace {
+
+	using namespace formatter::arg_formatter;
+
+	constexpr std::string_view validFormat { "[{:>8}] id={} elapsed={:.3f}ms ok={}" };
+	// the same line with an invalid integer spec in its last integer field, so both policies do the same work before failing
+	constexpr std::string_view invalidFormat { "[{:>8}] id={:q} elapsed={:.3f}ms ok={}" };
+
+	template<typename Call> af_bench::LatencyResult Measure(std::string name, size_t messages, Call&& call) {
+		af_bench::LatencyResult result { std::move(name) };
+		std::string line;
+		for( size_t i { 0 }; i < messages; ++i ) {
+				line.clear();
+				auto start { af_bench::NowNs() };
+				call(line, i);
+				result.Record(af_bench::NowNs() - start);
+			}
+		return result;
+	}
+
+}    // namespace
+
+void af_bench::RunErrorBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	ArgFormatter formatter;
+	size_t failures { 0 };
+	auto elapsed { [](size_t i) { return static_cast<double>(i % 1000) * 0.125; } };
+
+	reporter.LatencySection("Error Handling: Valid Format Strings");
+	auto throwing { Measure("format_to (throwing)", options.messages, [ & ](std::string& line, size_t i) {
+		formatter.format_to(std::back_inserter(line), validFormat, "INFO", i, elapsed(i), true);
+	}) };
+	reporter.ReportLatency(throwing);
+	auto status { Measure("try_format_to (status codes)", options.messages, [ & ](std::string& line, size_t i) {
+		failures += !formatter.try_format_to(std::back_inserter(line), validFormat, "INFO", i, elapsed(i), true);
+	}) };
+	reporter.ReportLatency(status);
+
+	reporter.LatencySection("Error Handling: Invalid Format Strings");
+#if defined(AF_NO_EXCEPTIONS)
+	// an error from format_to() ends the process in this build, so only the status codes can be timed
+	std::printf("%-40s %10s\n", "format_to + catch (throwing)", "skipped");
+#else
+	auto caught { Measure("format_to + catch (throwing)", options.messages, [ & ](std::string& line, size_t i) {
+		try {
+				formatter.format_to(std::back_inserter(line), invalidFormat, "INFO", i, elapsed(i), true);
+		} catch( const formatter::af_errors::error_handler::format_error& ) {
+				++failures;
+			}
+	}) };
+	reporter.ReportLatency(caught);
+#endif
+	auto returned { Measure("try_format_to (status codes)", options.messages, [ & ](std::string& line, size_t i) {
+		failures += !formatter.try_format_to(std::back_inserter(line), invalidFormat, "INFO", i, elapsed(i), true);
+	}) };
+	reporter.ReportLatency(returned);
+	std::printf("%-40s %10zu\n", "Failed calls", failures);
+}
@@ -0,0 +1,99 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgFormatter.h>
+
+namespace {
+
+	// How JSON log lines were built before the 'j' spec: every string escaped into a temporary first
+	std::string PreEscape(std::string_view text) {
+		std::string escaped;
+		escaped.reserve(text.size());
+		for( auto c: text ) {
+				switch( c ) {
+						case '"': escaped += "\\\""; break;
+						case '\\': escaped += "\\\\"; break;
+						case '\n': escaped += "\\n"; break;
+						case '\r': escaped += "\\r"; break;
+						case '\t': escaped += "\\t"; break;
+						default:
+							if( static_cast<unsigned char>(c) < 0x20 ) {
+									constexpr std::string_view digits { "0123456789abcdef" };
+									escaped += "\\u00";
+									escaped += digits[ static_cast<unsigned char>(c) >> 4 ];
+									escaped += digits[ c & 0x0F ];
+							} else {
+									escaped += c;
+								}
+							break;
+					}
+			}
+		return escaped;
+	}
+
+	// 'escapeEvery' places a character that needs escaping every that many chars, 0 for none at all
+	std::vector<std::string> MakeMessages(size_t count, size_t escapeEvery) {
+		constexpr std::string_view words { "request handled for user account with session token and cache lookup " };
+		constexpr std::string_view escapes { "\"\\\n\t" };
+		std::vector<std::string> messages;
+		messages.reserve(count);
+		for( size_t i { 0 }; i < count; ++i ) {
+				std::string message;
+				for( size_t pos { 0 }; pos < 200; ++pos ) {
+						message += escapeEvery != 0 && (pos + i) % escapeEvery == 0 ? escapes[ pos % escapes.size() ] : words[ (pos + i) % words.size() ];
+					}
+				messages.push_back(std::move(message));
+			}
+		return messages;
+	}
+
+	constexpr std::string_view lineFormat { R"("level":"info","id":{},"msg":"{}")" "\n" };
+	constexpr std::string_view escapedLineFormat { R"("level":"info","id":{},"msg":"{:j}")" "\n" };
+
+	af_bench::BenchResult BenchPreEscaped(std::string name, const std::vector<std::string>& messages) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		af_bench::Stopwatch timer;
+		for( size_t i { 0 }; i < messages.size(); ++i ) formatter::format_to(std::back_inserter(out), lineFormat, i, PreEscape(messages[ i ]));
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size();
+		result.rows    = messages.size();
+		return result;
+	}
+
+	af_bench::BenchResult BenchEscapeOnWrite(std::string name, const std::vector<std::string>& messages) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		af_bench::Stopwatch timer;
+		for( size_t i { 0 }; i < messages.size(); ++i ) formatter::format_to(std::back_inserter(out), escapedLineFormat, i, messages[ i ]);
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size();
+		result.rows    = messages.size();
+		return result;
+	}
+
+	// Table cells padded by display width; the ASCII cells take the byte-count path and the others are measured code point by code point
+	af_bench::BenchResult BenchPaddedCells(std::string name, std::string_view cell, size_t rows) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		af_bench::Stopwatch timer;
+		for( size_t i { 0 }; i < rows; ++i ) formatter::format_to(std::back_inserter(out), "|{: <24}|{: >24}|\n", cell, cell);
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size();
+		result.rows    = rows;
+		return result;
+	}
+
+}    // namespace
+
+void af_bench::RunEscapeBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	reporter.RowsSection("JSON Escaping: Pre-Escaped Temporary vs '{:j}' (200 Char Messages)");
+	for( auto [ label, escapeEvery ]: { std::pair { "clean ascii", size_t { 0 } }, std::pair { "mixed", size_t { 40 } }, std::pair { "escape heavy", size_t { 3 } } } ) {
+			auto messages { MakeMessages(options.messages, escapeEvery) };
+			reporter.ReportRows(BenchPreEscaped(std::string(label) + ": pre-escaped", messages));
+			reporter.ReportRows(BenchEscapeOnWrite(std::string(label) + ": escape on write", messages));
+		}
+	reporter.RowsSection("Display Width: Padded Table Cells");
+	reporter.ReportRows(BenchPaddedCells("ascii cell", "request handled", options.messages));
+	reporter.ReportRows(BenchPaddedCells("accented cell", "requ\xC3\xAAte trait\xC3\xA9\x65", options.messages));
+	reporter.ReportRows(BenchPaddedCells("cjk cell", "\xE8\xAF\xB7\xE6\xB1\x82\xE5\xB7\xB2\xE5\xA4\x84\xE7\x90\x86", options.messages));
+}
@@ -0,0 +1,69 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgFormatter.h>
+
+#include <charconv>
+#include <random>
+
+namespace {
+
+	// Prices, latencies and ratios: magnitudes from 0.001 to 1,000,000 with every fractional digit in use
+	std::vector<double> MakeValues(size_t count) {
+		std::vector<double> values;
+		values.reserve(count);
+		std::mt19937_64 rng { 11 };
+		std::uniform_real_distribution<double> exponent { -3.0, 6.0 };
+		for( size_t i { 0 }; i < count; ++i ) values.push_back((i % 2 == 0 ? 1.0 : -1.0) * std::pow(10.0, exponent(rng)));
+		return values;
+	}
+
+	// The digits are appended to an output that's started over once it reaches 64KB, so that they're actually used
+	template<typename Writer> af_bench::BenchResult BenchWriter(std::string name, const std::vector<double>& values, Writer&& write) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		char text[ 512 ];
+		af_bench::Stopwatch timer;
+		for( auto value: values ) {
+				out.append(text, write(value, text));
+				if( out.size() >= 1 << 16 ) {
+						result.bytes += out.size();
+						out.clear();
+				}
+			}
+		result.seconds = timer.Elapsed();
+		result.bytes += out.size();
+		result.rows = values.size();
+		return result;
+	}
+
+	af_bench::BenchResult BenchFormatTo(std::string name, const std::vector<double>& values, std::string_view fmt) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		out.reserve(values.size() * 24);
+		af_bench::Stopwatch timer;
+		for( auto value: values ) formatter::format_to(std::back_inserter(out), fmt, value);
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size();
+		result.rows    = values.size();
+		return result;
+	}
+
+}    // namespace
+
+void af_bench::RunFloatBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	auto values { MakeValues(options.messages) };
+	reporter.RowsSection("Fixed Precision: std::to_chars vs The Scaled Integer Fast Path");
+	for( int precision: { 2, 3, 6 } ) {
+			auto label { "{:." + std::to_string(precision) + "f}: " };
+			reporter.ReportRows(BenchWriter(label + "to_chars", values, [ precision ](double value, char* text) {
+				return std::to_chars(text, text + 512, value, std::chars_format::fixed, precision).ptr;
+			}));
+			reporter.ReportRows(BenchWriter(label + "fast path", values, [ precision ](double value, char* text) {
+				return formatter::arg_formatter::WriteFixedPrecision(value, precision, text);
+			}));
+			auto fmt { "{:." + std::to_string(precision) + "f}" };
+			reporter.ReportRows(BenchFormatTo(label + "format_to", values, fmt));
+		}
+	// above the fast path's precision, for reference
+	reporter.ReportRows(BenchFormatTo("{:.12f}: format_to (to_chars)", values, "{:.12f}"));
+}
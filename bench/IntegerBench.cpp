@@ -0,0 +1,105 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgFormatter.h>
+
+#include <charconv>
+#include <random>
+
+namespace {
+
+	// Values that fill the given number of bits, so every row writes about the same number of digits per value
+	std::vector<uint64_t> MakeValues(size_t count, unsigned bits) {
+		std::vector<uint64_t> values;
+		values.reserve(count);
+		std::mt19937_64 rng { 7 };
+		auto mask { bits == 64 ? ~uint64_t { 0 } : (uint64_t { 1 } << bits) - 1 };
+		auto top { uint64_t { 1 } << (bits - 1) };
+		for( size_t i { 0 }; i < count; ++i ) values.push_back((rng() & mask) | top);
+		return values;
+	}
+
+	// The digits are appended to an output that's started over once it reaches 64KB, so that they're actually used and the rows measure the digit writes
+	// rather than the output's reallocations
+	void Keep(std::string& out, const char* text, const char* end, af_bench::BenchResult& result) {
+		out.append(text, end);
+		if( out.size() >= 1 << 16 ) {
+				result.bytes += out.size();
+				out.clear();
+		}
+	}
+
+	// How the digits used to be written: std::to_chars() in the base followed by a pass that upper cases them
+	af_bench::BenchResult BenchToChars(std::string name, const std::vector<uint64_t>& values, int base, bool upper) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		char text[ 72 ];
+		af_bench::Stopwatch timer;
+		for( auto value: values ) {
+				auto end { std::to_chars(text, text + sizeof(text), value, base).ptr };
+				if( upper ) {
+						for( auto ch { text }; ch != end; ++ch ) {
+								if( *ch >= 'a' && *ch <= 'f' ) *ch -= 32;
+							}
+				}
+				Keep(out, text, end, result);
+			}
+		result.seconds = timer.Elapsed();
+		result.bytes += out.size();
+		result.rows = values.size();
+		return result;
+	}
+
+	af_bench::BenchResult BenchKernel(std::string name, const std::vector<uint64_t>& values, int base, bool upper) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		char text[ 72 ];
+		auto bitsPerDigit { base == 16 ? 4 : base == 8 ? 3 : 1 };
+		af_bench::Stopwatch timer;
+		for( auto value: values ) {
+				auto digits { static_cast<size_t>((std::bit_width(value) + bitsPerDigit - 1) / bitsPerDigit) };
+				auto end { base == 16  ? formatter::simd::WriteHexDigits(value, digits, text, upper)
+					       : base == 8 ? formatter::simd::WriteOctalDigits(value, digits, text)
+					                   : formatter::simd::WriteBinaryDigits(value, digits, text) };
+				Keep(out, text, end, result);
+			}
+		result.seconds = timer.Elapsed();
+		result.bytes += out.size();
+		result.rows = values.size();
+		return result;
+	}
+
+	af_bench::BenchResult BenchFormatTo(std::string name, const std::vector<uint64_t>& values, std::string_view fmt) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		out.reserve(values.size() * 24);
+		af_bench::Stopwatch timer;
+		for( auto value: values ) formatter::format_to(std::back_inserter(out), fmt, value);
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size();
+		result.rows    = values.size();
+		return result;
+	}
+
+}    // namespace
+
+void af_bench::RunIntegerBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	struct BaseCase
+	{
+		std::string_view spec;
+		int base;
+		bool upper;
+	};
+	reporter.RowsSection("Integer Bases: std::to_chars (+ Upper Case Pass) vs Digit Kernels");
+	for( auto [ spec, base, upper ]: { BaseCase { "x", 16, false }, BaseCase { "X", 16, true }, BaseCase { "o", 8, false }, BaseCase { "b", 2, false } } ) {
+			for( unsigned bits: { 8, 16, 32, 64 } ) {
+					auto values { MakeValues(options.messages, bits) };
+					auto label { "{:" + std::string(spec) + "} " + std::to_string(bits) + " bit: " };
+					reporter.ReportRows(BenchToChars(label + "to_chars", values, base, upper));
+					reporter.ReportRows(BenchKernel(label + "kernel", values, base, upper));
+				}
+		}
+
+	reporter.RowsSection("Integer Bases: format_to Per Spec (64 Bit Values)");
+	auto values { MakeValues(options.messages, 64) };
+	for( std::string_view fmt: { "{:x}", "{:X}", "{:#x}", "{:016X}", "{:o}", "{:b}", "{:d}" } ) reporter.ReportRows(BenchFormatTo(std::string(fmt), values, fmt));
+}
@@ -0,0 +1,92 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgFormatter.h>
+
+#include <ctime>
+
+namespace {
+
+	using namespace formatter::arg_formatter;
+
+	// Every scenario gets its own ArgFormatter and output so that its first call is a cold one: the formatter's buffers haven't grown yet and
+	// nothing it looks up has been touched
+	template<typename Call> af_bench::LatencyResult Measure(std::string name, size_t calls, Call&& call) {
+		af_bench::LatencyResult result { std::move(name) };
+		ArgFormatter formatter;
+		std::string line;
+		for( size_t i { 0 }; i < calls; ++i ) {
+				line.clear();
+				auto start { af_bench::NowNs() };
+				call(formatter, line, i);
+				result.Record(af_bench::NowNs() - start);
+			}
+		return result;
+	}
+
+	std::tm TimeAt(size_t i) {
+		std::tm time {};
+		time.tm_year = 124;
+		time.tm_mon  = static_cast<int>(i % 12);
+		time.tm_mday = 1 + static_cast<int>(i % 28);
+		time.tm_hour = static_cast<int>(i % 24);
+		time.tm_min  = static_cast<int>(i % 60);
+		time.tm_sec  = static_cast<int>((i / 60) % 60);
+		time.tm_wday = static_cast<int>(i % 7);
+		return time;
+	}
+
+	double ValueAt(size_t i) {
+		return static_cast<double>(i % 100'000) * 12.375;
+	}
+
+}    // namespace
+
+void af_bench::RunLatencyBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	auto calls { options.messages };
+	auto report { [ & ](std::string name, std::string_view fmt, auto&& argAt) {
+		auto result { Measure(std::move(name), calls, [ & ](ArgFormatter& formatter, std::string& line, size_t i) {
+			formatter.format_to(std::back_inserter(line), fmt, argAt(i));
+		}) };
+		reporter.ReportLatency(result);
+	} };
+
+	reporter.LatencySection("Latency Distribution: Single Fields");
+	report("int {}", "{}", [](size_t i) { return static_cast<int>(i); });
+	report("double {:.3f}", "{:.3f}", ValueAt);
+	report("double {}", "{}", ValueAt);
+	report("string_view {}", "{}", [](size_t) { return std::string_view("some-service-account"); });
+
+	// the fill is written in place, so the wide fields show whether growing the output is the only cost left in the tail
+	reporter.LatencySection("Latency Distribution: Alignment");
+	report("int {:>16}", "{:>16}", [](size_t i) { return i; });
+	report("int {:*^256}", "{:*^256}", [](size_t i) { return i; });
+	report("int {:>4096}", "{:>4096}", [](size_t i) { return i; });
+
+	reporter.LatencySection("Latency Distribution: Time Specs (std::tm)");
+	report("tm {:%F %T}", "{:%F %T}", TimeAt);
+	report("tm {:%a %b %d %Y}", "{:%a %b %d %Y}", TimeAt);
+	report("tm {:%c}", "{:%c}", TimeAt);
+
+	reporter.LatencySection("Latency Distribution: Log Line");
+	auto line { Measure("[{:>8}] user={} id={:x} took {:.3f}ms", calls, [](ArgFormatter& formatter, std::string& out, size_t i) {
+		formatter.format_to(std::back_inserter(out), "[{:>8}] user={} id={:x} took {:.3f}ms", "INFO", "some-service-account", i, ValueAt(i));
+	}) };
+	reporter.ReportLatency(line);
+
+#if !defined(AF_NO_LOCALE)
+	// the localized paths go through the locale's facets on every call, and a localized time through std::put_time() as well
+	reporter.LatencySection("Latency Distribution: Localized ('L') Formatting");
+	auto loc { GroupingLocale() };
+	auto reportLocalized { [ & ](std::string name, std::string_view fmt, auto&& argAt) {
+		auto result { Measure(std::move(name), calls, [ & ](ArgFormatter& formatter, std::string& out, size_t i) {
+			formatter.format_to(std::back_inserter(out), loc, fmt, argAt(i));
+		}) };
+		reporter.ReportLatency(result);
+	} };
+	reportLocalized("int {:L}", "{:L}", [](size_t i) { return static_cast<int>(i * 7919); });
+	reportLocalized("double {:.2Lf}", "{:.2Lf}", ValueAt);
+	reportLocalized("bool {:L}", "{:L}", [](size_t i) { return i % 2 == 0; });
+	reportLocalized("tm {:L%H:%M:%S}", "{:L%H:%M:%S}", TimeAt);
+	reportLocalized("tm {:L%c}", "{:L%c}", TimeAt);
+#endif
+}
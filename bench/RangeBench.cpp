@@ -0,0 +1,139 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgFormatter.h>
+
+namespace {
+
+	// What formatting a range looked like before ranges were supported natively: a wrapper type whose CustomFormatter formats each element
+	template<typename T> struct PerElement
+	{
+		const std::vector<T>& values;
+	};
+
+}    // namespace
+
+template<typename T> struct formatter::CustomFormatter<PerElement<T>>
+{
+	constexpr void Parse(std::string_view) { }
+	template<typename resultCtx> constexpr auto Format(const PerElement<T>& range, resultCtx& ctx) const {
+		formatter::format_to(std::back_inserter(ctx), "[");
+		for( size_t i { 0 }; i < range.values.size(); ++i ) {
+				formatter::format_to(std::back_inserter(ctx), i == 0 ? "{}" : ", {}", range.values[ i ]);
+			}
+		formatter::format_to(std::back_inserter(ctx), "]");
+	}
+};
+
+namespace {
+
+	// The per-byte way of logging a payload as hex: one substitution for every byte
+	struct PerByteHex
+	{
+		const std::vector<unsigned char>& payload;
+	};
+
+}    // namespace
+
+template<> struct formatter::CustomFormatter<PerByteHex>
+{
+	constexpr void Parse(std::string_view) { }
+	template<typename resultCtx> constexpr auto Format(const PerByteHex& bytes, resultCtx& ctx) const {
+		for( auto byte: bytes.payload ) formatter::format_to(std::back_inserter(ctx), "{:0>2x}", static_cast<unsigned int>(byte));
+	}
+};
+
+namespace {
+
+	// Encoding to a temporary string first and then formatting that string, as was needed before byte ranges had a base64 spec
+	struct TempBase64
+	{
+		const std::vector<unsigned char>& payload;
+	};
+
+}    // namespace
+
+template<> struct formatter::CustomFormatter<TempBase64>
+{
+	constexpr void Parse(std::string_view) { }
+	template<typename resultCtx> constexpr auto Format(const TempBase64& bytes, resultCtx& ctx) const {
+		constexpr std::string_view digits { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/" };
+		auto& payload { bytes.payload };
+		std::string encoded;
+		encoded.reserve((payload.size() + 2) / 3 * 4);
+		for( size_t i { 0 }; i < payload.size(); i += 3 ) {
+				uint32_t bits { static_cast<uint32_t>(payload[ i ]) << 16 };
+				if( i + 1 < payload.size() ) bits |= static_cast<uint32_t>(payload[ i + 1 ]) << 8;
+				if( i + 2 < payload.size() ) bits |= payload[ i + 2 ];
+				encoded += digits[ bits >> 18 ];
+				encoded += digits[ (bits >> 12) & 0x3F ];
+				encoded += i + 1 < payload.size() ? digits[ (bits >> 6) & 0x3F ] : '=';
+				encoded += i + 2 < payload.size() ? digits[ bits & 0x3F ] : '=';
+			}
+		formatter::format_to(std::back_inserter(ctx), "{}", encoded);
+	}
+};
+
+namespace {
+
+	template<typename Arg> af_bench::BenchResult BenchFormat(std::string name, std::string_view fmt, const Arg& arg, size_t elements) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		af_bench::Stopwatch timer;
+		formatter::format_to(std::back_inserter(out), fmt, arg);
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size();
+		result.rows    = elements;
+		return result;
+	}
+
+	template<typename Arg> af_bench::BenchResult BenchPayload(std::string name, std::string_view fmt, const Arg& arg, size_t payloadSize, size_t repeats) {
+		af_bench::BenchResult result { std::move(name) };
+		std::string out;
+		af_bench::Stopwatch timer;
+		for( size_t i { 0 }; i < repeats; ++i ) {
+				out.clear();
+				formatter::format_to(std::back_inserter(out), fmt, arg);
+				result.bytes += out.size();
+			}
+		result.seconds = timer.Elapsed();
+		result.rows    = payloadSize * repeats;
+		return result;
+	}
+
+}    // namespace
+
+void af_bench::RunRangeBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	std::vector<int> ints(options.messages);
+	std::vector<double> doubles(options.messages);
+	for( size_t i { 0 }; i < options.messages; ++i ) {
+			ints[ i ]    = static_cast<int>(i * 7919) - 1'000'000;
+			doubles[ i ] = static_cast<double>(i) * 0.3125;
+		}
+	reporter.RowsSection("Range Formatting: Native Bulk Kernel vs Per-Element CustomFormatter (Rows = Elements)");
+	reporter.ReportRows(BenchFormat("vector<int> per-element custom", "{}", PerElement<int> { ints }, ints.size()));
+	reporter.ReportRows(BenchFormat("vector<int> native", "{}", ints, ints.size()));
+	reporter.ReportRows(BenchFormat("vector<int> native with element spec", "{::x}", ints, ints.size()));
+	reporter.ReportRows(BenchFormat("vector<double> per-element custom", "{}", PerElement<double> { doubles }, doubles.size()));
+	reporter.ReportRows(BenchFormat("vector<double> native", "{}", doubles, doubles.size()));
+	reporter.ReportRows(BenchFormat("vector<double> native with element spec", "{::.3f}", doubles, doubles.size()));
+
+	// 64 KiB packet payloads; the rows column counts the payload bytes converted
+	constexpr size_t payloadSize { 64 * 1024 };
+	constexpr size_t repeats { 256 };
+	std::vector<unsigned char> payload(payloadSize);
+	for( size_t i { 0 }; i < payloadSize; ++i ) payload[ i ] = static_cast<unsigned char>(i * 131 + 7);
+	reporter.RowsSection("Byte Range Formatting: 64 KiB Payloads, Native Hex vs One Substitution Per Byte (Rows = Bytes)");
+	reporter.ReportRows(BenchPayload("per-byte custom hex", "{}", PerByteHex { payload }, payloadSize, repeats));
+	reporter.ReportRows(BenchPayload("native hex '{:x}'", "{:x}", payload, payloadSize, repeats));
+	reporter.ReportRows(BenchPayload("native grouped hex '{:x4}'", "{:x4}", payload, payloadSize, repeats));
+	reporter.ReportRows(BenchPayload("native hexdump '{:h}'", "{:h}", payload, payloadSize, repeats));
+
+	// 1 MiB blobs; Rows/s is the input consumed per second and MB/s the base64 text produced per second
+	constexpr size_t blobSize { 1024 * 1024 };
+	constexpr size_t blobRepeats { 64 };
+	std::vector<unsigned char> blob(blobSize);
+	for( size_t i { 0 }; i < blobSize; ++i ) blob[ i ] = static_cast<unsigned char>(i * 89 + 3);
+	reporter.RowsSection("Byte Range Formatting: 1 MiB Blobs As Base64 (Rows = Input Bytes)");
+	reporter.ReportRows(BenchPayload("temporary string then '{}'", "{}", TempBase64 { blob }, blobSize, blobRepeats));
+	reporter.ReportRows(BenchPayload("native base64 '{:b64}'", "{:b64}", blob, blobSize, blobRepeats));
+}
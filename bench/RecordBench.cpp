@@ -0,0 +1,116 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgFormatter.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace formatter::arg_formatter;
+using formatter::msg_details::ArgRecord;
+using formatter::msg_details::ArgRecordView;
+using formatter::msg_details::RecordRingBuffer;
+
+namespace {
+
+	constexpr std::string_view logFormat { "[{}] user={} request={:x} took {:.3f}ms path={}\n" };
+	constexpr std::string_view userName { "some-service-account" };
+	const std::string requestPath { "/api/v2/orders/search?region=eu-west&limit=100" };
+
+	af_bench::LatencyResult MeasureCapture(size_t messages) {
+		af_bench::LatencyResult result { "ArgRecord::Capture (deferred)" };
+		ArgRecord record;
+		for( size_t i { 0 }; i < messages; ++i ) {
+				auto start { af_bench::NowNs() };
+				record.Capture(logFormat, "INFO", userName, i, static_cast<double>(i % 1000) * 0.125, requestPath);
+				result.Record(af_bench::NowNs() - start);
+			}
+		return result;
+	}
+
+	af_bench::LatencyResult MeasureSynchronous(size_t messages) {
+		af_bench::LatencyResult result { "format_to std::string (synchronous)" };
+		ArgFormatter formatter;
+		std::string line;
+		for( size_t i { 0 }; i < messages; ++i ) {
+				line.clear();
+				auto start { af_bench::NowNs() };
+				formatter.format_to(std::back_inserter(line), logFormat, "INFO", userName, i, static_cast<double>(i % 1000) * 0.125, requestPath);
+				result.Record(af_bench::NowNs() - start);
+			}
+		return result;
+	}
+
+	af_bench::LatencyResult MeasureReplay(size_t messages) {
+		af_bench::LatencyResult result { "format_record (consumer side)" };
+		ArgFormatter formatter;
+		ArgRecord record(logFormat, "INFO", userName, size_t { 12345 }, 0.125, requestPath);
+		std::string line;
+		for( size_t i { 0 }; i < messages; ++i ) {
+				line.clear();
+				auto start { af_bench::NowNs() };
+				formatter.format_record_to(std::back_inserter(line), record.View());
+				result.Record(af_bench::NowNs() - start);
+			}
+		return result;
+	}
+
+	constexpr size_t ringCapacity { 1 << 20 };
+
+	// 'producers' threads each push their share of 'messages' into one ring while a single consumer drains and formats everything; the enqueue
+	// latencies of every producer are merged, and the consumer's formatted output over the whole run is reported as its drain throughput
+	std::pair<af_bench::LatencyResult, af_bench::BenchResult> MeasureRingContention(size_t producers, size_t messages) {
+		auto label { "RecordRingBuffer (" + std::to_string(producers) + (producers == 1 ? " producer)" : " producers)") };
+		std::pair<af_bench::LatencyResult, af_bench::BenchResult> result { af_bench::LatencyResult { label }, af_bench::BenchResult { label } };
+		RecordRingBuffer ring(ringCapacity);
+		std::vector<af_bench::LatencyResult> latencies(producers);
+		std::atomic<size_t> finished { 0 };
+		auto perProducer { messages / producers };
+
+		af_bench::Stopwatch timer;
+		std::vector<std::thread> threads;
+		for( size_t p { 0 }; p < producers; ++p ) {
+				threads.emplace_back([ &, p ]() {
+					for( size_t i { 0 }; i < perProducer; ++i ) {
+							auto start { af_bench::NowNs() };
+							ring.Push(logFormat, "INFO", userName, i, static_cast<double>(i % 1000) * 0.125, requestPath);
+							latencies[ p ].Record(af_bench::NowNs() - start);
+						}
+					finished.fetch_add(1, std::memory_order_release);
+				});
+			}
+		ArgFormatter formatter;
+		std::string lines;
+		for( ;; ) {
+				auto done { finished.load(std::memory_order_acquire) == producers };
+				ring.Drain([ & ](const ArgRecordView& view) { formatter.format_record_to(std::back_inserter(lines), view); });
+				result.second.bytes += lines.size();
+				lines.clear();
+				if( done ) break;
+			}
+		result.second.seconds = timer.Elapsed();
+		for( auto& thread: threads ) thread.join();
+		for( auto& perThread: latencies ) result.first.Merge(perThread);
+		return result;
+	}
+
+}    // namespace
+
+void af_bench::RunRecordBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	reporter.LatencySection("Deferred Formatting: Producer Cost Per Message");
+	auto capture { MeasureCapture(options.messages) };
+	reporter.ReportLatency(capture);
+	auto synchronous { MeasureSynchronous(options.messages) };
+	reporter.ReportLatency(synchronous);
+	auto replay { MeasureReplay(options.messages) };
+	reporter.ReportLatency(replay);
+
+	std::vector<BenchResult> drainResults;
+	reporter.LatencySection("Deferred Formatting: RecordRingBuffer Enqueue Latency Under Contention");
+	for( size_t producers: { 1, 2, 4, 8, 16, 32 } ) {
+			auto [ enqueue, drain ] { MeasureRingContention(producers, options.messages) };
+			reporter.ReportLatency(enqueue);
+			drainResults.push_back(std::move(drain));
+		}
+	reporter.Section("Deferred Formatting: RecordRingBuffer Drain Throughput (Single Consumer)");
+	for( auto& drain: drainResults ) reporter.Report(drain);
+}
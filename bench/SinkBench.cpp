@@ -0,0 +1,197 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgSinks.h>
+
+#include <fstream>
+
+using namespace formatter::arg_formatter;
+
+namespace {
+
+	// A representative CSV export row: an id, a label, a measurement, a flag and a hex checksum
+	constexpr std::string_view rowFormat { "{},{},{:.4f},{},{:x}\n" };
+	constexpr std::string_view rowLabel { "sensor-reading" };
+
+	inline double RowValue(size_t row) {
+		return static_cast<double>(row) * 0.3125;
+	}
+
+	// When 'preformatted' is set, every benchmark writes this fixed row instead so that only the cost of the output path itself is measured
+	constexpr std::string_view fixedRow { "1048576,sensor-reading,327680.0000,true,100000\n" };
+
+	af_bench::BenchResult BenchMappedFile(const af_bench::BenchOptions& options, bool preformatted) {
+		auto path { options.outputDir / "af_bench_mapped.csv" };
+		ArgFormatter formatter;
+		af_bench::BenchResult result { "MappedFileSink" };
+		af_bench::Stopwatch timer;
+		{
+			formatter::sinks::MappedFileSink sink(path.string());
+			for( size_t row { 0 }; row < options.rows; ++row ) {
+					if( preformatted ) {
+							sink.append(fixedRow.data(), fixedRow.size());
+							continue;
+					}
+					formatter.format_to(std::back_inserter(sink), rowFormat, row, rowLabel, RowValue(row), row % 2 == 0, row);
+				}
+			result.bytes = sink.size();
+			sink.Close();
+		}
+		result.seconds = timer.Elapsed();
+		std::filesystem::remove(path);
+		return result;
+	}
+
+	af_bench::BenchResult BenchFwrite(const af_bench::BenchOptions& options, bool preformatted) {
+		auto path { options.outputDir / "af_bench_fwrite.csv" };
+		ArgFormatter formatter;
+		af_bench::BenchResult result { "std::string + fwrite" };
+		af_bench::Stopwatch timer;
+		auto file { std::fopen(path.string().c_str(), "wb") };
+		if( file == nullptr ) return result;
+		std::string line;
+		for( size_t row { 0 }; row < options.rows; ++row ) {
+				line.clear();
+				preformatted ? void(line.append(fixedRow))
+							 : formatter.format_to(std::back_inserter(line), rowFormat, row, rowLabel, RowValue(row), row % 2 == 0, row);
+				std::fwrite(line.data(), 1, line.size(), file);
+				result.bytes += line.size();
+			}
+		std::fclose(file);
+		result.seconds = timer.Elapsed();
+		std::filesystem::remove(path);
+		return result;
+	}
+
+	af_bench::BenchResult BenchOfstream(const af_bench::BenchOptions& options, bool preformatted) {
+		auto path { options.outputDir / "af_bench_ofstream.csv" };
+		ArgFormatter formatter;
+		af_bench::BenchResult result { "std::string + std::ofstream" };
+		af_bench::Stopwatch timer;
+		{
+			std::ofstream file(path, std::ios::binary);
+			std::string line;
+			for( size_t row { 0 }; row < options.rows; ++row ) {
+					line.clear();
+					preformatted ? void(line.append(fixedRow))
+								 : formatter.format_to(std::back_inserter(line), rowFormat, row, rowLabel, RowValue(row), row % 2 == 0, row);
+					file.write(line.data(), static_cast<std::streamsize>(line.size()));
+					result.bytes += line.size();
+				}
+		}
+		result.seconds = timer.Elapsed();
+		std::filesystem::remove(path);
+		return result;
+	}
+
+	// Lines dominated by long string payloads, written out in batches of 'linesPerWrite' lines per system call
+	constexpr std::string_view payloadFormat { "{} seq={} body={} trailer={}\n" };
+	constexpr size_t linesPerWrite { 64 };
+
+	af_bench::BenchResult BenchScatterGather(const af_bench::BenchOptions& options, const std::string& payload, std::string_view trailer) {
+		auto path { options.outputDir / "af_bench_writev.log" };
+		ArgFormatter formatter;
+		af_bench::BenchResult result { "ScatterGatherSink + writev" };
+		auto fd { ::open(path.string().c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) };
+		if( fd == -1 ) return result;
+		af_bench::Stopwatch timer;
+		formatter::sinks::ScatterGatherSink sink;
+		for( size_t row { 0 }; row < options.rows; ++row ) {
+				formatter.format_to(std::back_inserter(sink), payloadFormat, "EVENT", row, payload, trailer);
+				if( (row + 1) % linesPerWrite == 0 || row + 1 == options.rows ) {
+						result.bytes += sink.size();
+						sink.WriteTo(fd);
+						sink.Clear();
+				}
+			}
+		::close(fd);
+		result.seconds = timer.Elapsed();
+		std::filesystem::remove(path);
+		return result;
+	}
+
+	af_bench::BenchResult BenchContiguousWrite(const af_bench::BenchOptions& options, const std::string& payload, std::string_view trailer) {
+		auto path { options.outputDir / "af_bench_write.log" };
+		ArgFormatter formatter;
+		af_bench::BenchResult result { "std::string + write" };
+		auto fd { ::open(path.string().c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) };
+		if( fd == -1 ) return result;
+		af_bench::Stopwatch timer;
+		std::string lines;
+		for( size_t row { 0 }; row < options.rows; ++row ) {
+				formatter.format_to(std::back_inserter(lines), payloadFormat, "EVENT", row, payload, trailer);
+				if( (row + 1) % linesPerWrite == 0 || row + 1 == options.rows ) {
+						result.bytes += lines.size();
+						for( size_t written { 0 }; written < lines.size(); ) {
+								auto count { ::write(fd, lines.data() + written, lines.size() - written) };
+								if( count <= 0 ) break;
+								written += static_cast<size_t>(count);
+							}
+						lines.clear();
+				}
+			}
+		::close(fd);
+		result.seconds = timer.Elapsed();
+		std::filesystem::remove(path);
+		return result;
+	}
+
+	// A typical service log line: a level tag, a request id, a latency measurement and a short status message
+	constexpr std::string_view logFormat { "[{}] request={:x} took {:.3f}ms status={}\n" };
+
+	template<typename Sink, typename OnMessageEnd>
+	af_bench::LatencyResult MeasureLogLatency(std::string name, Sink& sink, size_t messages, OnMessageEnd&& onMessageEnd) {
+		ArgFormatter formatter;
+		af_bench::LatencyResult result { std::move(name) };
+		for( size_t i { 0 }; i < messages; ++i ) {
+				auto start { af_bench::NowNs() };
+				formatter.format_to(std::back_inserter(sink), logFormat, "INFO", i, static_cast<double>(i % 1000) * 0.125, "ok");
+				onMessageEnd(sink);
+				result.Record(af_bench::NowNs() - start);
+			}
+		return result;
+	}
+
+}    // namespace
+
+void af_bench::RunSinkLatencyBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	using namespace formatter::sinks;
+	reporter.LatencySection("Format + Enqueue Latency Per Message");
+	{
+		auto path { options.outputDir / "af_bench_sync.log" };
+		{
+			FileSink sink(path.string());
+			auto result { MeasureLogLatency("FileSink (synchronous write)", sink, options.messages, [](FileSink&) {}) };
+			reporter.ReportLatency(result);
+		}
+		std::filesystem::remove(path);
+	}
+	for( auto [ policy, name ] : { std::pair { Backpressure::Block, "AsyncFileSink (Block)" }, std::pair { Backpressure::Drop, "AsyncFileSink (Drop)" },
+	                               std::pair { Backpressure::Grow, "AsyncFileSink (Grow)" } } )
+		{
+			auto path { options.outputDir / "af_bench_async.log" };
+			{
+				AsyncFileSink sink(path.string(), AF_SINK_DEFAULT_BUFFER, policy);
+				auto result { MeasureLogLatency(name, sink, options.messages, [](AsyncFileSink& s) { s.Commit(); }) };
+				reporter.ReportLatency(result);
+			}
+			std::filesystem::remove(path);
+		}
+}
+
+void af_bench::RunSinkBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	reporter.Section("Bulk File Output Throughput (Formatting + Output)");
+	reporter.Report(BenchMappedFile(options, false));
+	reporter.Report(BenchFwrite(options, false));
+	reporter.Report(BenchOfstream(options, false));
+
+	reporter.Section("Bulk File Output Throughput (Output Path Only)");
+	reporter.Report(BenchMappedFile(options, true));
+	reporter.Report(BenchFwrite(options, true));
+	reporter.Report(BenchOfstream(options, true));
+
+	std::string payload(4096, 'x');
+	std::string trailer(256, 'y');
+	reporter.Section("Payload-Heavy Lines (4KiB + 256B String Arguments)");
+	reporter.Report(BenchContiguousWrite(options, payload, trailer));
+	reporter.Report(BenchScatterGather(options, payload, trailer));
+}
@@ -0,0 +1,45 @@
+#include "BenchHarness.h"
+
+#include <ArgFormatter/ArgFormatter.h>
+
+namespace {
+
+	std::vector<std::string> MakeMessages(size_t count, std::string_view words) {
+		std::vector<std::string> messages;
+		messages.reserve(count);
+		for( size_t i { 0 }; i < count; ++i ) {
+				std::string message;
+				while( message.size() < 200 ) message += words;
+				messages.push_back(std::move(message));
+			}
+		return messages;
+	}
+
+	constexpr std::string_view lineFormat { "[{}] session {} -> {}\n" };
+
+	// The utf-8 rows are the baseline the utf-16 and utf-32 rows pay their transcoding on top of
+	template<typename Container> af_bench::BenchResult BenchFormatTo(std::string name, const std::vector<std::string>& messages) {
+		af_bench::BenchResult result { std::move(name) };
+		Container out;
+		af_bench::Stopwatch timer;
+		for( size_t i { 0 }; i < messages.size(); ++i ) formatter::format_to(std::back_inserter(out), lineFormat, "info", i, messages[ i ]);
+		result.seconds = timer.Elapsed();
+		result.bytes   = out.size() * sizeof(typename Container::value_type);
+		result.rows    = messages.size();
+		return result;
+	}
+
+}    // namespace
+
+void af_bench::RunTranscodeBenchmarks(const BenchOptions& options, BenchReporter& reporter) {
+	reporter.RowsSection("Transcoding: UTF-8 Arguments Into UTF-16/UTF-32 Containers (200 Char Messages)");
+	for( auto [ label, words ]: { std::pair { "ascii", std::string_view { "request handled for user account " } },
+	                              std::pair { "accented", std::string_view { "requ\xC3\xAAte trait\xC3\xA9\x65 pour le compte " } },
+	                              std::pair { "cjk", std::string_view { "\xE8\xAF\xB7\xE6\xB1\x82\xE5\xB7\xB2\xE5\xA4\x84\xE7\x90\x86 " } } } )
+		{
+			auto messages { MakeMessages(options.messages, words) };
+			reporter.ReportRows(BenchFormatTo<std::string>(std::string(label) + ": utf-8", messages));
+			reporter.ReportRows(BenchFormatTo<std::u16string>(std::string(label) + ": utf-16", messages));
+			reporter.ReportRows(BenchFormatTo<std::u32string>(std::string(label) + ": utf-32", messages));
+		}
+}
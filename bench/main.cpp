@@ -0,0 +1,92 @@
+#include "BenchHarness.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+	struct BenchGroup
+	{
+		const char* name;
+		void (*run)(const af_bench::BenchOptions&, af_bench::BenchReporter&);
+	};
+
+	// Run in this order; '--only' picks groups out by name
+	constexpr BenchGroup benchGroups[] {
+		{ "sink", af_bench::RunSinkBenchmarks },
+		{ "sink-latency", af_bench::RunSinkLatencyBenchmarks },
+		{ "record", af_bench::RunRecordBenchmarks },
+		{ "batch", af_bench::RunBatchBenchmarks },
+		{ "range", af_bench::RunRangeBenchmarks },
+		{ "escape", af_bench::RunEscapeBenchmarks },
+		{ "transcode", af_bench::RunTranscodeBenchmarks },
+		{ "align", af_bench::RunAlignBenchmarks },
+		{ "integer", af_bench::RunIntegerBenchmarks },
+		{ "float", af_bench::RunFloatBenchmarks },
+		{ "error", af_bench::RunErrorBenchmarks },
+		{ "compare", af_bench::RunComparisonBenchmarks },
+		{ "latency", af_bench::RunLatencyBenchmarks },
+	};
+
+}    // namespace
+
+static void PrintUsage(const char* exe) {
+	std::printf("Usage: %s [--rows N] [--messages N] [--dir PATH] [--csv PATH] [--json PATH] [--pin CORE] [--only GROUP]...\n", exe);
+	std::printf("Groups:");
+	for( auto& group: benchGroups ) std::printf(" %s", group.name);
+	std::printf("\n");
+}
+
+int main(int argc, char** argv) {
+	af_bench::BenchOptions options;
+	std::vector<std::string_view> only;
+	for( int i { 1 }; i < argc; ++i ) {
+			if( std::strcmp(argv[ i ], "--rows") == 0 && i + 1 < argc ) {
+					options.rows = std::strtoull(argv[ ++i ], nullptr, 10);
+			} else if( std::strcmp(argv[ i ], "--messages") == 0 && i + 1 < argc ) {
+					options.messages = std::strtoull(argv[ ++i ], nullptr, 10);
+			} else if( std::strcmp(argv[ i ], "--dir") == 0 && i + 1 < argc ) {
+					options.outputDir = argv[ ++i ];
+			} else if( std::strcmp(argv[ i ], "--csv") == 0 && i + 1 < argc ) {
+					options.csvPath = argv[ ++i ];
+			} else if( std::strcmp(argv[ i ], "--json") == 0 && i + 1 < argc ) {
+					options.jsonPath = argv[ ++i ];
+			} else if( std::strcmp(argv[ i ], "--pin") == 0 && i + 1 < argc ) {
+					options.pinCore = std::atoi(argv[ ++i ]);
+			} else if( std::strcmp(argv[ i ], "--only") == 0 && i + 1 < argc ) {
+					only.emplace_back(argv[ ++i ]);
+			} else {
+					PrintUsage(argv[ 0 ]);
+					return 1;
+				}
+		}
+	for( auto name: only ) {
+			if( std::none_of(std::begin(benchGroups), std::end(benchGroups), [ name ](const BenchGroup& group) { return name == group.name; }) ) {
+					PrintUsage(argv[ 0 ]);
+					return 1;
+			}
+		}
+
+	// the threads the multi-threaded groups start inherit the pinning on Linux, so those are best left out of a pinned run with '--only'
+	if( options.pinCore >= 0 ) {
+			if( !af_bench::PinToCore(options.pinCore) ) {
+					std::fprintf(stderr, "Unable To Pin The Benchmarks To Core %d\n", options.pinCore);
+					return 1;
+			}
+			std::printf("Pinned To Core %d\n", options.pinCore);
+	}
+
+	af_bench::BenchReporter reporter;
+	for( auto& group: benchGroups ) {
+			if( only.empty() || std::find(only.begin(), only.end(), group.name) != only.end() ) group.run(options, reporter);
+		}
+	if( !options.csvPath.empty() && !reporter.WriteCsv(options.csvPath) ) {
+			std::fprintf(stderr, "Unable To Write The CSV Results To '%s'\n", options.csvPath.string().c_str());
+			return 1;
+	}
+	if( !options.jsonPath.empty() && !reporter.WriteJson(options.jsonPath) ) {
+			std::fprintf(stderr, "Unable To Write The JSON Results To '%s'\n", options.jsonPath.string().c_str());
+			return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "ArgSinks.h"
+
+#include <exception>
+#include <ranges>
+#include <thread>
+#include <tuple>
+
+/*********************************************************************************************************************************************************
+ * Batch formatting formats every row of a large row set against one format string, where each row is a std::tuple (or anything std::apply accepts)
+ * holding that row's arguments. The rows are split into contiguous slices, one per worker thread; every worker formats its slice with its own
+ * ArgFormatter through format_rows_to(), so the format string is parsed once per slice, and the chunks are then stitched back together in row order
+ * so the output is identical to formatting the rows one at a time. A 'threadCount' of 0 uses every available core, and small batches use fewer
+ * workers than requested since a thread per handful of rows costs more than it saves.
+ *********************************************************************************************************************************************************/
+namespace formatter {
+
+	// Slices smaller than this aren't worth a worker thread of their own
+	constexpr size_t AF_BATCH_MIN_ROWS_PER_THREAD { 1024 };
+
+	namespace internal_helper::af_concepts {
+		template<typename T>
+		concept BatchRows = std::ranges::random_access_range<T> && std::ranges::sized_range<T>;
+	}    // namespace internal_helper::af_concepts
+
+	template<internal_helper::af_concepts::BatchRows Rows>
+	[[nodiscard]] std::string format_batch(std::string_view sv, const Rows& rows, size_t threadCount = 0);
+	// Stitches the formatted chunks into any container or sink accepted by format_to() whose code units are chars
+	template<typename T, internal_helper::af_concepts::BatchRows Rows>
+	void format_batch_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, const Rows& rows, size_t threadCount = 0);
+#if !defined(_WIN32)
+	// Writes the chunks out to 'fd' in order with writev(2) instead of copying them into one buffer first; returns the number of bytes written
+	template<internal_helper::af_concepts::BatchRows Rows> size_t format_batch_write(int fd, std::string_view sv, const Rows& rows, size_t threadCount = 0);
+#endif
+
+	namespace batch_helper {
+		// Clamps the requested worker count to the hardware and to the number of rows there are to split
+		inline size_t WorkerCount(size_t requested, size_t rowCount);
+		// Formats 'rows' with 'sv' across the workers and returns one chunk per worker in row order
+		template<typename Rows> std::vector<std::string> FormatChunks(std::string_view sv, const Rows& rows, size_t threadCount);
+	}    // namespace batch_helper
+
+}    // namespace formatter
+
+#include "ArgBatchImpl.h"
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "ArgBatch.h"
+
+inline size_t formatter::batch_helper::WorkerCount(size_t requested, size_t rowCount) {
+	auto workers { requested == 0 ? static_cast<size_t>(std::thread::hardware_concurrency()) : requested };
+	workers = std::min(workers, rowCount / AF_BATCH_MIN_ROWS_PER_THREAD);
+	return std::max(workers, size_t { 1 });
+}
+
+template<typename Rows> std::vector<std::string> formatter::batch_helper::FormatChunks(std::string_view sv, const Rows& rows, size_t threadCount) {
+	auto rowCount { static_cast<size_t>(std::ranges::size(rows)) };
+	auto workers { WorkerCount(threadCount, rowCount) };
+	std::vector<std::string> chunks(workers);
+#if !defined(AF_NO_EXCEPTIONS)
+	std::vector<std::exception_ptr> errors(workers);
+#endif
+
+	auto formatSlice { [ & ](size_t index) {
+#if !defined(AF_NO_EXCEPTIONS)
+		try {
+#endif
+			arg_formatter::ArgFormatter formatter;
+			auto& chunk { chunks[ index ] };
+			auto first { rowCount * index / workers };
+			auto last { rowCount * (index + 1) / workers };
+			auto begin { std::ranges::begin(rows) };
+			formatter.format_rows_to(std::back_inserter(chunk), sv, std::ranges::subrange(begin + first, begin + last));
+#if !defined(AF_NO_EXCEPTIONS)
+		}
+		catch( ... ) {
+			errors[ index ] = std::current_exception();
+		}
+#endif
+	} };
+
+	std::vector<std::thread> threads;
+	threads.reserve(workers - 1);
+	size_t started { 1 };
+#if !defined(AF_NO_EXCEPTIONS)
+	try {
+#endif
+		for( ; started < workers; ++started ) {
+				threads.emplace_back(formatSlice, started);
+			}
+#if !defined(AF_NO_EXCEPTIONS)
+	} catch( ... ) {
+			// a thread that couldn't be started leaves its slices to the calling thread below, and the ones that were started still get joined rather
+			// than being destroyed while joinable (which would call std::terminate())
+		}
+#endif
+	// the calling thread takes the first slice instead of sitting idle until the others are done
+	formatSlice(0);
+	for( auto index { started }; index < workers; ++index ) formatSlice(index);
+	for( auto& thread: threads ) thread.join();
+#if !defined(AF_NO_EXCEPTIONS)
+	for( auto& error: errors ) {
+			if( error ) std::rethrow_exception(error);
+		}
+#endif
+	return chunks;
+}
+
+template<formatter::internal_helper::af_concepts::BatchRows Rows>
+std::string formatter::format_batch(std::string_view sv, const Rows& rows, size_t threadCount) {
+	std::string tmp;
+	format_batch_to(std::back_inserter(tmp), sv, rows, threadCount);
+	return tmp;
+}
+
+template<typename T, formatter::internal_helper::af_concepts::BatchRows Rows>
+void formatter::format_batch_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, const Rows& rows, size_t threadCount) {
+	using namespace internal_helper::af_concepts;
+	auto& container { internal_helper::IteratorAccessHelper(std::move(Iter)).Container() };
+	auto chunks { batch_helper::FormatChunks(sv, rows, threadCount) };
+	if constexpr( is_format_sink_v<T> ) {
+			for( auto& chunk: chunks ) container.append(chunk.data(), chunk.size());
+	} else {
+			static_assert(sizeof(typename T::value_type) == 1, "Batch Formatting Only Supports Containers Of 8-Bit Code Units");
+			if constexpr( requires { container.reserve(size_t {}); } ) {
+					size_t total { container.size() };
+					for( auto& chunk: chunks ) total += chunk.size();
+					container.reserve(total);
+			}
+			for( auto& chunk: chunks ) container.insert(container.end(), chunk.begin(), chunk.end());
+		}
+}
+
+#if !defined(_WIN32)
+template<formatter::internal_helper::af_concepts::BatchRows Rows>
+size_t formatter::format_batch_write(int fd, std::string_view sv, const Rows& rows, size_t threadCount) {
+	auto chunks { batch_helper::FormatChunks(sv, rows, threadCount) };
+	sinks::ScatterGatherSink sink;
+	for( auto& chunk: chunks ) sink.append_ref(chunk.data(), chunk.size());
+	sink.WriteTo(fd);
+	return sink.size();
+}
+#endif
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "ArgSinks.h"
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+/*********************************************************************************************************************************************************
+ * The binary log keeps text formatting off of the logging path entirely: each call writes the id of its format string, a timestamp and the packed
+ * arguments, and the text is only produced later on by BinaryLogReader (or the af-decode tool) through the exact same ArgFormatter engine. A format
+ * string is written out in full once, as a definition entry, the first time it's seen and is referred to by its id from then on.
+ *
+ * File layout (native byte order, so a log has to be decoded on a machine with the same byte order and type sizes as the one that wrote it):
+ *   header:     [ "AFBL" ][ u32 version ][ u32 byte order mark ]
+ *   definition: [ u8 1 ][ u32 format id ][ u32 size ][ format string bytes ]
+ *   record:     [ u8 2 ][ u8 arg count ][ u32 format id ][ u64 timestamp (ns since epoch) ][ u32 size ][ args... ]
+ *   where the args are packed exactly as they are in an ArgRecord: [ u8 SpecType ][ payload ]
+ *********************************************************************************************************************************************************/
+namespace formatter::binary_log {
+
+	constexpr std::string_view AF_BINARY_LOG_MAGIC { "AFBL" };
+	constexpr uint32_t AF_BINARY_LOG_VERSION { 1 };
+	constexpr uint32_t AF_BINARY_LOG_BYTE_ORDER { 0x0102'0304 };
+	constexpr size_t AF_BINARY_LOG_HEADER_SIZE { 12 };
+
+	enum class EntryKind : unsigned char
+	{
+		Definition = 1,
+		Record     = 2,
+	};
+
+	// Transparent hashing so looking up a format string's id doesn't construct a std::string on every call
+	struct format_string_hash
+	{
+		using is_transparent = void;
+		size_t operator()(std::string_view sv) const noexcept {
+			return std::hash<std::string_view> {}(sv);
+		}
+	};
+
+#if !defined(_WIN32)
+	class BinaryLogWriter
+	{
+	  public:
+		explicit BinaryLogWriter(std::string_view path, size_t bufferSize = sinks::AF_SINK_DEFAULT_BUFFER);
+		BinaryLogWriter(const BinaryLogWriter&)            = delete;
+		BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+		~BinaryLogWriter()                                 = default;
+
+		// Stamps the record with the current system time
+		template<typename... Args> void Write(std::string_view sv, Args&&... args);
+		template<typename... Args> void WriteAt(uint64_t timestamp, std::string_view sv, Args&&... args);
+		void Flush();
+		void Close();
+		[[nodiscard]] size_t size() const;
+
+	  private:
+		uint32_t FormatId(std::string_view sv);
+
+	  private:
+		sinks::FileSink file;
+		std::unordered_map<std::string, uint32_t, format_string_hash, std::equal_to<>> formatIds;
+		std::vector<unsigned char> entry;
+	};
+#endif
+
+	class BinaryLogReader
+	{
+	  public:
+		explicit BinaryLogReader(std::string_view path);
+		BinaryLogReader(const BinaryLogReader&)            = delete;
+		BinaryLogReader& operator=(const BinaryLogReader&) = delete;
+		~BinaryLogReader()                                 = default;
+
+		// Calls 'onRecord(uint64_t timestamp, const ArgRecordView&)' for every record in the order they were written and returns the count
+		template<typename Callback> size_t ForEachRecord(Callback&& onRecord);
+		// Formats every record, back to back, into 'container'
+		template<typename T> size_t DecodeTo(arg_formatter::ArgFormatter& formatter, T& container);
+
+	  private:
+		std::vector<unsigned char> contents;
+		std::vector<std::string_view> definitions;
+		std::vector<unsigned char> scratch;
+		af_errors::error_handler errHandle;
+	};
+
+}    // namespace formatter::binary_log
+
+#include "ArgBinaryLogImpl.h"
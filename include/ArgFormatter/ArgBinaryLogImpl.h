@@ -0,0 +1,154 @@
+#pragma once
+
+#include "ArgBinaryLog.h"
+
+namespace formatter::binary_log::log_helper {
+
+	// kind + arg count + format id + timestamp + args size
+	constexpr size_t recordEntryHeaderSize { 1 + 1 + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint32_t) };
+	// kind + format id + size
+	constexpr size_t definitionEntryHeaderSize { 1 + sizeof(uint32_t) + sizeof(uint32_t) };
+
+	inline uint64_t NowNs() {
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+	}
+
+}    // namespace formatter::binary_log::log_helper
+
+#if !defined(_WIN32)
+/*********************************************************************** BinaryLogWriter ************************************************************************/
+inline formatter::binary_log::BinaryLogWriter::BinaryLogWriter(std::string_view path, size_t bufferSize): file(path, bufferSize), formatIds(), entry() {
+	using msg_details::record_helper::WriteRaw;
+	unsigned char header[ AF_BINARY_LOG_HEADER_SIZE ];
+	auto dest { header };
+	std::memcpy(dest, AF_BINARY_LOG_MAGIC.data(), AF_BINARY_LOG_MAGIC.size());
+	dest += AF_BINARY_LOG_MAGIC.size();
+	WriteRaw(dest, AF_BINARY_LOG_VERSION);
+	WriteRaw(dest, AF_BINARY_LOG_BYTE_ORDER);
+	file.append(reinterpret_cast<const char*>(header), sizeof(header));
+}
+
+inline uint32_t formatter::binary_log::BinaryLogWriter::FormatId(std::string_view sv) {
+	using msg_details::record_helper::WriteRaw;
+	if( auto found { formatIds.find(sv) }; found != formatIds.end() ) return found->second;
+	auto id { static_cast<uint32_t>(formatIds.size()) };
+	formatIds.emplace(std::string(sv), id);
+	entry.resize(log_helper::definitionEntryHeaderSize);
+	auto dest { entry.data() };
+	*dest++ = static_cast<unsigned char>(EntryKind::Definition);
+	WriteRaw(dest, id);
+	WriteRaw(dest, static_cast<uint32_t>(sv.size()));
+	file.append(reinterpret_cast<const char*>(entry.data()), entry.size());
+	file.append(sv.data(), sv.size());
+	return id;
+}
+
+template<typename... Args> void formatter::binary_log::BinaryLogWriter::Write(std::string_view sv, Args&&... args) {
+	WriteAt(log_helper::NowNs(), sv, std::forward<Args>(args)...);
+}
+
+template<typename... Args> void formatter::binary_log::BinaryLogWriter::WriteAt(uint64_t timestamp, std::string_view sv, Args&&... args) {
+	using namespace msg_details::record_helper;
+	static_assert(sizeof...(Args) < MAX_ARG_COUNT, "Too Many Arguments Supplied To Formatting Function");
+	auto id { FormatId(sv) };
+	size_t argsSize { (size_t { 0 } + ... + EncodedArgSize(args)) };
+	entry.resize(log_helper::recordEntryHeaderSize + argsSize);
+	auto dest { entry.data() };
+	*dest++ = static_cast<unsigned char>(EntryKind::Record);
+	*dest++ = static_cast<unsigned char>(sizeof...(Args));
+	WriteRaw(dest, id);
+	WriteRaw(dest, timestamp);
+	WriteRaw(dest, static_cast<uint32_t>(argsSize));
+	(EncodeArg(dest, args), ...);
+	file.append(reinterpret_cast<const char*>(entry.data()), entry.size());
+}
+
+inline void formatter::binary_log::BinaryLogWriter::Flush() {
+	file.Flush();
+}
+
+inline void formatter::binary_log::BinaryLogWriter::Close() {
+	file.Close();
+}
+
+inline size_t formatter::binary_log::BinaryLogWriter::size() const {
+	return file.size();
+}
+#endif
+
+/*********************************************************************** BinaryLogReader ************************************************************************/
+inline formatter::binary_log::BinaryLogReader::BinaryLogReader(std::string_view path): contents(), definitions(), scratch(), errHandle() {
+	using msg_details::record_helper::ReadRaw;
+	std::ifstream file(std::string(path), std::ios::binary | std::ios::ate);
+	if( !file.is_open() ) {
+			errHandle.ReportError(af_errors::ErrorType::sink_open_failed);
+	}
+	contents.resize(static_cast<size_t>(file.tellg()));
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+	if( contents.size() < AF_BINARY_LOG_HEADER_SIZE || std::memcmp(contents.data(), AF_BINARY_LOG_MAGIC.data(), AF_BINARY_LOG_MAGIC.size()) != 0 ) {
+			errHandle.ReportError(af_errors::ErrorType::binary_log_corrupt);
+	}
+	const unsigned char* src { contents.data() + AF_BINARY_LOG_MAGIC.size() };
+	auto version { ReadRaw<uint32_t>(src) };
+	if( version != AF_BINARY_LOG_VERSION || ReadRaw<uint32_t>(src) != AF_BINARY_LOG_BYTE_ORDER ) {
+			errHandle.ReportError(af_errors::ErrorType::binary_log_corrupt);
+	}
+}
+
+template<typename Callback> size_t formatter::binary_log::BinaryLogReader::ForEachRecord(Callback&& onRecord) {
+	using namespace msg_details::record_helper;
+	using msg_details::AF_RECORD_HEADER_SIZE;
+	definitions.clear();
+	size_t records { 0 };
+	const unsigned char* src { contents.data() + AF_BINARY_LOG_HEADER_SIZE };
+	const unsigned char* end { contents.data() + contents.size() };
+	while( src != end ) {
+			switch( static_cast<EntryKind>(*src) ) {
+					case EntryKind::Definition:
+						{
+							if( static_cast<size_t>(end - src) < log_helper::definitionEntryHeaderSize ) errHandle.ReportError(af_errors::ErrorType::binary_log_corrupt);
+							++src;
+							auto id { ReadRaw<uint32_t>(src) };
+							auto size { ReadRaw<uint32_t>(src) };
+							if( id != definitions.size() || static_cast<size_t>(end - src) < size ) errHandle.ReportError(af_errors::ErrorType::binary_log_corrupt);
+							definitions.emplace_back(reinterpret_cast<const char*>(src), size);
+							src += size;
+							break;
+						}
+					case EntryKind::Record:
+						{
+							if( static_cast<size_t>(end - src) < log_helper::recordEntryHeaderSize ) errHandle.ReportError(af_errors::ErrorType::binary_log_corrupt);
+							++src;
+							auto argCount { *src++ };
+							auto id { ReadRaw<uint32_t>(src) };
+							auto timestamp { ReadRaw<uint64_t>(src) };
+							auto size { ReadRaw<uint32_t>(src) };
+							if( id >= definitions.size() || static_cast<size_t>(end - src) < size ) errHandle.ReportError(af_errors::ErrorType::binary_log_corrupt);
+							// rebuild an in-memory ArgRecord around the packed args so replaying goes through the same path as any other deferred record
+							scratch.resize(AF_RECORD_HEADER_SIZE + size);
+							auto dest { scratch.data() };
+							WriteRaw(dest, static_cast<uint32_t>(scratch.size()));
+							*dest++ = argCount;
+							std::memset(dest, 0, 3);
+							dest += 3;
+							WriteRaw(dest, definitions[ id ].data());
+							WriteRaw(dest, definitions[ id ].size());
+							std::memcpy(dest, src, size);
+							src += size;
+							msg_details::ArgRecordView view(scratch);
+							// walk the args once up front so that a callback that reads them itself never sees a record that runs past its end
+							if( !view.ForEachArg([](auto&&, msg_details::SpecType) {}) ) errHandle.ReportError(af_errors::ErrorType::binary_log_corrupt);
+							onRecord(timestamp, view);
+							++records;
+							break;
+						}
+					default: errHandle.ReportError(af_errors::ErrorType::binary_log_corrupt); break;
+				}
+		}
+	return records;
+}
+
+template<typename T> size_t formatter::binary_log::BinaryLogReader::DecodeTo(arg_formatter::ArgFormatter& formatter, T& container) {
+	return ForEachRecord([ & ](uint64_t, const msg_details::ArgRecordView& view) { formatter.format_record_to(std::back_inserter(container), view); });
+}
@@ -2,7 +2,13 @@
 
 #include <string_view>
 #include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <ctime>
 #include <iterator>
+#include <ranges>
+#include <string>
 #include <variant>
 #include <vector>
 
@@ -30,6 +36,9 @@ namespace formatter {
 
 	template<typename Value> struct CustomFormatter
 	{
+		// only the unspecialized template has this, which is how a user's specialization is told apart from it
+		using primary_formatter_tag = void;
+
 		constexpr CustomFormatter()                                  = default;
 		constexpr CustomFormatter(const CustomFormatter&)            = default;
 		constexpr CustomFormatter& operator=(const CustomFormatter&) = default;
@@ -41,6 +50,10 @@ namespace formatter {
 		template<typename ValueType, typename ContainerCtx> constexpr auto Format(ValueType&&, ContainerCtx&&) { }
 	};
 
+	namespace msg_details {
+		enum class SpecType;
+	}    // namespace msg_details
+
 	namespace internal_helper {
 
 		template<typename T> struct IteratorAccessHelper: public std::back_insert_iterator<T>
@@ -96,11 +109,31 @@ namespace formatter {
 			const void* container;
 			FormatCallBackFunc CustomFormatCallBack;
 		};
+
+		// Argument-side view of a contiguous range of native values. The element type is erased at capture time, so the two callbacks are what give
+		// the formatter typed access back: one stores a single element into an argument slot and the other converts a run of arithmetic elements
+		// straight into a char block without going through the argument slots at all.
+		struct RangeValue
+		{
+			using StoreElementFunc = void (*)(const void* data, size_t index, void* slot);
+			using FillBlockFunc    = size_t (*)(const void* data, size_t& index, size_t size, std::string_view separator, char* dest, size_t capacity);
+
+			const void* data { nullptr };
+			size_t size { 0 };
+			msg_details::SpecType elementType {};
+			std::string_view separator { ", " };
+			std::string_view opening { "[" };
+			std::string_view closing { "]" };
+			StoreElementFunc StoreElement { nullptr };
+			FillBlockFunc FillBlock { nullptr };
+			// set for ranges of std::byte or unsigned char, which additionally accept the hex and hexdump specs
+			bool isByteRange { false };
+		};
 	}    // namespace internal_helper
 	namespace internal_helper::af_typedefs {
 		// clang-format off
 		using VType = std::variant<std::monostate, std::string, const char*, std::string_view, int, unsigned int, long long,
-			unsigned long long, bool, char, float, double, long double, const void*, void*, std::tm, internal_helper::CustomValue>;
+			unsigned long long, bool, char, float, double, long double, const void*, void*, std::tm, internal_helper::CustomValue, internal_helper::RangeValue>;
 		// clang-format on
 	}    // namespace internal_helper::af_typedefs
 
@@ -124,6 +157,8 @@ namespace formatter {
 		{
 		};
 		template<typename T> inline constexpr bool has_formatter_v = has_formatter<T>::value;
+		// True when CustomFormatter has been specialized for 'T', which takes precedence over any native formatting of it (such as for ranges)
+		template<typename T> inline constexpr bool has_custom_formatter_v = !requires { typename CustomFormatter<T>::primary_formatter_tag; };
 
 		template<typename T> struct is_formattable;
 		template<typename T>
@@ -132,6 +167,43 @@ namespace formatter {
 		{
 		};
 		template<typename T> inline constexpr bool is_formattable_v = is_formattable<T>::value;
+
+		// Sinks are output targets that aren't standard containers (files, mappings, etc...) and are flagged by exposing a 'format_sink_tag'
+		// typedef. They only need to provide 'append(const char*, size_t)' and 'push_back(char)' for the formatter to write into them.
+		template<typename T> struct is_format_sink: std::bool_constant<requires { typename internal_helper::af_typedefs::type<T>::format_sink_tag; }>
+		{
+		};
+		template<typename T> inline constexpr bool is_format_sink_v = is_format_sink<T>::value;
+
+		// Reference sinks additionally provide 'append_ref(const char*, size_t)' for data that outlives the formatting call (the format string itself and
+		// caller-owned string arguments) so that they can point at it rather than copying it
+		template<typename T>
+		struct is_reference_sink
+			: std::bool_constant<is_format_sink_v<T> && requires(internal_helper::af_typedefs::type<T>& sink, const char* data, size_t size) { sink.append_ref(data, size); }>
+		{
+		};
+		template<typename T> inline constexpr bool is_reference_sink_v = is_reference_sink<T>::value;
+
+		// Ranges that are formatted natively rather than through a CustomFormatter: contiguous ranges of arithmetic or string elements. Ranges of
+		// character types are strings rather than ranges of chars, and arrays are left alone so that char arrays keep being treated as c-strings.
+		template<typename T>
+		inline constexpr bool is_range_element_v = (std::is_arithmetic_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, signed char> &&
+		                                            !std::is_same_v<T, unsigned char> && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t> &&
+		                                            !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>) ||
+		                                           std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> || std::is_same_v<T, const char*>;
+		// Byte buffers are ranges as well; their elements are formatted as unsigned values unless one of the hex specs is used
+		template<typename T> inline constexpr bool is_byte_element_v = std::is_same_v<T, std::byte> || std::is_same_v<T, unsigned char>;
+		template<typename T> struct is_formattable_range: std::bool_constant<false>
+		{
+		};
+		template<typename T>
+		requires std::ranges::contiguous_range<T> && std::ranges::sized_range<T> && (!std::is_array_v<T>)
+		struct is_formattable_range<T>
+			: std::bool_constant<is_range_element_v<std::remove_cv_t<std::ranges::range_value_t<T>>> ||
+		                         is_byte_element_v<std::remove_cv_t<std::ranges::range_value_t<T>>>>
+		{
+		};
+		template<typename T> inline constexpr bool is_formattable_range_v = is_formattable_range<internal_helper::af_typedefs::type<T>>::value;
 	}    // namespace internal_helper::af_concepts
 
 }    // namespace formatter
@@ -157,6 +229,7 @@ namespace formatter::msg_details {
 		VoidPtrType      = 14,
 		CTimeType        = 15,
 		CustomType       = 16,
+		RangeType        = 17,
 	};
 
 	constexpr size_t MAX_ARG_COUNT = 25;
@@ -176,6 +249,9 @@ namespace formatter::msg_details {
 		template<typename Iter, typename... Args> constexpr auto StoreArgs(Iter&& iter, Args&&... args) -> decltype(iter);
 		template<typename T> constexpr void StoreNativeArg(T&& arg);
 		template<typename Iter, typename T> constexpr auto StoreCustomArg(Iter&& iter, T&& arg) -> decltype(iter);
+		// Used when replaying a deferred ArgRecord, where every value has already been classified and decoded
+		constexpr void ResetCapture();
+		template<typename T> constexpr void StoreRecordArg(T&& value, SpecType type);
 
 		constexpr std::array<internal_helper::af_typedefs::VType, MAX_ARG_COUNT>& ArgStorage();
 		constexpr const std::array<SpecType, MAX_ARG_COUNT>& SpecTypesCaptured() const;
@@ -195,6 +271,7 @@ namespace formatter::msg_details {
 		constexpr void* void_ptr_state(size_t index) const;
 		constexpr const std::tm& c_time_state(size_t index) const;
 		constexpr const internal_helper::CustomValue& custom_state(size_t index) const;
+		constexpr const internal_helper::RangeValue& range_state(size_t index) const;
 
 	  public:
 		bool isCustomFormatter;
@@ -223,6 +300,11 @@ namespace formatter::msg_details {
 				return std::forward<SpecType>(LongLongType);
 		} else if constexpr( std::is_same_v<internal_helper::af_typedefs::type<T>, unsigned long long> ) {
 				return std::forward<SpecType>(U_LongLongType);
+		} else if constexpr( std::is_same_v<internal_helper::af_typedefs::type<T>, long> ) {
+				// 'long' is 32 bits on Windows and 64 bits on most other platforms, so it's stored as whichever type it matches in width
+				return std::forward<SpecType>(sizeof(long) == sizeof(int) ? IntType : LongLongType);
+		} else if constexpr( std::is_same_v<internal_helper::af_typedefs::type<T>, unsigned long> ) {
+				return std::forward<SpecType>(sizeof(unsigned long) == sizeof(unsigned int) ? U_IntType : U_LongLongType);
 		} else if constexpr( std::is_same_v<internal_helper::af_typedefs::type<T>, bool> ) {
 				return std::forward<SpecType>(BoolType);
 		} else if constexpr( std::is_same_v<internal_helper::af_typedefs::type<T>, char> ) {
@@ -239,6 +321,10 @@ namespace formatter::msg_details {
 				return std::forward<SpecType>(VoidPtrType);
 		} else if constexpr( std::is_same_v<internal_helper::af_typedefs::type<T>, std::tm> ) {
 				return std::forward<SpecType>(CTimeType);
+		} else if constexpr( std::is_same_v<internal_helper::af_typedefs::type<T>, internal_helper::RangeValue> ||
+		                     (internal_helper::af_concepts::is_formattable_range_v<T> &&
+		                      !internal_helper::af_concepts::has_custom_formatter_v<internal_helper::af_typedefs::type<T>>) ) {
+				return std::forward<SpecType>(RangeType);
 		}
 		// As odd as it is, the below 'else-if-else' branch case deals with 'char[]&'  and 'char[]' so as to treat those cases as c-style strings. If the
 		// base type is constructible, then we can test for the case of it being a c-string relative, if it's not constructible, then only references can be
@@ -246,7 +332,7 @@ namespace formatter::msg_details {
 		else if constexpr( std::is_constructible_v<internal_helper::af_typedefs::type<T>> )
 			{
 				// c-string literal
-				if constexpr( auto _ { std::remove_cvref_t<std::remove_extent_t<T>> {} }; std::is_same_v<decltype(_), char*> ) {
+				if constexpr( std::is_same_v<std::decay_t<std::remove_cvref_t<T>>, char*> ) {
 						return std::forward<SpecType>(CharPointerType);
 				} else {    // isn't a c-string relative or native type so return CustomType here
 						// clang-format off
@@ -265,6 +351,12 @@ namespace formatter::msg_details {
 				return std::forward<SpecType>(CustomType);
 			}
 	}
+
+	// Builds the type-erased view that ranges are captured as; 'separator', 'opening' and 'closing' must outlive the formatting call
+	template<typename Range>
+	requires internal_helper::af_concepts::is_formattable_range_v<Range>
+	constexpr internal_helper::RangeValue MakeRangeValue(const Range& range, std::string_view separator = ", ", std::string_view opening = "[",
+	                                                     std::string_view closing = "]");
 }    // namespace formatter::msg_details
 
 #include "ArgContainerImpl.h"
@@ -68,6 +68,11 @@ namespace formatter::msg_details {
 													argContainer[ counter ]  = std::string_view(std::move(tmp));
 													specContainer[ counter ] = SpecType::StringViewType;
 												}
+									} else if constexpr( af_concepts::is_reference_sink_v<typename af_typedefs::type<Iter>::container_type> &&
+									                     utf_constraints::is_string_v<ArgType> && std::is_lvalue_reference_v<ArgType> ) {
+											// reference sinks point straight at the caller's string, so there's no need to copy it here either
+											argContainer[ counter ]  = std::string_view(arg.data(), arg.size());
+											specContainer[ counter ] = SpecType::StringViewType;
 									} else {
 											using remove_ref        = formatter::internal_helper::af_typedefs::type<decltype(arg)>;
 											argContainer[ counter ] = remove_ref(arg);
@@ -119,10 +124,17 @@ namespace formatter::msg_details {
 					specContainer[ counter ] = GetArgType(std::forward<ArgType>(arg));
 					if constexpr( af_concepts::is_supported_v<af_typedefs::type<ArgType>> ) {
 							StoreNativeArg(std::forward<ArgType>(arg));
+					} else if constexpr( af_concepts::is_formattable_range_v<ArgType> && !af_concepts::has_custom_formatter_v<af_typedefs::type<ArgType>> ) {
+							StoreNativeArg(MakeRangeValue(arg));
+					} else if constexpr( std::is_same_v<af_typedefs::type<ArgType>, long> || std::is_same_v<af_typedefs::type<ArgType>, unsigned long> ) {
+							// no variant alternative exists for 'long' so store it as the same-width type that GetArgType() reported
+							using IntStorage  = std::conditional_t<sizeof(long) == sizeof(int), int, long long>;
+							using StorageType = std::conditional_t<std::is_signed_v<af_typedefs::type<ArgType>>, IntStorage, std::make_unsigned_t<IntStorage>>;
+							StoreNativeArg(static_cast<StorageType>(arg));
 					} else if constexpr( std::is_constructible_v<std::remove_cvref_t<std::remove_extent_t<ArgType>>> ) {
 							// test for cases of 'char[]&] and 'char[]' and treat as a c-string (storing it natively) -> solving
 							// https://github.com/USAFrenzy/ArgFormatter/issues/2
-							if constexpr( auto _ { std::remove_cvref_t<std::remove_extent_t<ArgType>> {} }; std::is_same_v<decltype(_), char*> ) {
+							if constexpr( std::is_same_v<std::decay_t<std::remove_cvref_t<ArgType>>, char*> ) {
 									StoreNativeArg(std::forward<const char*>(static_cast<const char*>(arg)));
 							} else {    // isn't a c-string relative or native type so store it as a custom type
 									iter = std::move(StoreCustomArg(std::move(iter), std::forward<ArgType>(arg)));
@@ -150,6 +162,18 @@ namespace formatter::msg_details {
 		return std::move(StoreArgs(std::move(iter), std::forward<Args>(args)...));
 	}
 
+	constexpr void ArgContainer::ResetCapture() {
+		counter = 0;
+		std::memset(specContainer.data(), 0, MAX_ARG_COUNT);
+	}
+
+	template<typename T> constexpr void ArgContainer::StoreRecordArg(T&& value, SpecType type) {
+		AF_ASSERT(counter < MAX_ARG_COUNT, "Too Many Arguments Supplied To Formatting Function");
+		argContainer[ counter ]  = std::forward<T>(value);
+		specContainer[ counter ] = type;
+		++counter;
+	}
+
 	constexpr const std::string_view ArgContainer::string_state(size_t index) const {
 		AF_ASSERT(index <= MAX_ARG_INDEX, "Error Retrieving Stored Value - Index Is Out Of Bounds");
 		AF_ASSERT(std::holds_alternative<std::string>(argContainer[ index ]), "Error Retrieving std::string: Variant At Index Provided Doesn't Contain This Type.");
@@ -255,4 +279,65 @@ namespace formatter::msg_details {
 		return *std::get_if<16>(&argContainer[ index ]);
 	}
 
+	constexpr const formatter::internal_helper::RangeValue& formatter::msg_details::ArgContainer::range_state(size_t index) const {
+		AF_ASSERT(index <= MAX_ARG_INDEX, "Error Retrieving Stored Value - Index Is Out Of Bounds");
+		// clang-format off
+		AF_ASSERT(std::holds_alternative<formatter::internal_helper::RangeValue>(argContainer[index]),
+			"Error Retrieving range value type: Variant At Index Provided Doesn't Contain This Type.");
+		// clang-format on
+		return *std::get_if<17>(&argContainer[ index ]);
+	}
+
+	template<typename Range>
+	requires internal_helper::af_concepts::is_formattable_range_v<Range>
+	constexpr internal_helper::RangeValue MakeRangeValue(const Range& range, std::string_view separator, std::string_view opening, std::string_view closing) {
+		using Element = std::remove_cv_t<std::ranges::range_value_t<Range>>;
+		constexpr auto isByteRange { internal_helper::af_concepts::is_byte_element_v<Element> };
+		internal_helper::RangeValue value;
+		value.data        = std::ranges::data(range);
+		value.size        = static_cast<size_t>(std::ranges::size(range));
+		value.elementType = isByteRange ? SpecType::U_IntType : GetArgType(Element {});
+		value.separator   = separator;
+		value.opening     = opening;
+		value.closing     = closing;
+		value.isByteRange = isByteRange;
+		value.StoreElement = [](const void* data, size_t index, void* slot) {
+			auto& element { static_cast<const Element*>(data)[ index ] };
+			auto& variant { *static_cast<internal_helper::af_typedefs::VType*>(slot) };
+			if constexpr( isByteRange ) {
+					variant = static_cast<unsigned int>(element);
+			} else if constexpr( std::is_same_v<Element, std::string> ) {
+					variant = std::string_view(element);
+			} else if constexpr( std::is_same_v<Element, long> || std::is_same_v<Element, unsigned long> ) {
+					using IntStorage  = std::conditional_t<sizeof(long) == sizeof(int), int, long long>;
+					using StorageType = std::conditional_t<std::is_signed_v<Element>, IntStorage, std::make_unsigned_t<IntStorage>>;
+					variant           = static_cast<StorageType>(element);
+			} else {
+					variant = element;
+				}
+		};
+		if constexpr( (std::is_arithmetic_v<Element> && !std::is_same_v<Element, bool>) || isByteRange ) {
+				// every element is converted in place with std::to_chars; returns once the next element might not fit so the caller can flush the block
+				value.FillBlock = [](const void* data, size_t& index, size_t size, std::string_view delimiter, char* dest, size_t capacity) -> size_t {
+					constexpr size_t maxElementSize { 64 };
+					auto values { static_cast<const Element*>(data) };
+					auto pos { dest };
+					auto end { dest + capacity };
+					for( ; index < size && static_cast<size_t>(end - pos) >= maxElementSize + delimiter.size(); ++index ) {
+							if( index != 0 ) {
+									std::memcpy(pos, delimiter.data(), delimiter.size());
+									pos += delimiter.size();
+							}
+							if constexpr( isByteRange ) {
+									pos = std::to_chars(pos, end, static_cast<unsigned int>(values[ index ])).ptr;
+							} else {
+									pos = std::to_chars(pos, end, values[ index ]).ptr;
+								}
+						}
+					return static_cast<size_t>(pos - dest);
+				};
+		}
+		return value;
+	}
+
 }    // namespace formatter::msg_details
\ No newline at end of file
@@ -1,12 +1,50 @@
 #pragma once
 
 #include "ArgContainer.h"
+#include "ArgRecord.h"
+#include "ArgSimd.h"
+#include "ArgUnicode.h"
 
+#include <atomic>
 #include <charconv>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
-#include <locale>
+#include <limits>
+#include <ranges>
 #include <stdexcept>
+#include <tuple>
+
+/*********************************************************************************************************************************************************
+ * Build configuration:
+ * - AF_NO_EXCEPTIONS: errors are handed to the callback set with af_errors::SetErrorCallback() and the process is then aborted, instead of throwing a
+ *   format_error. This is picked automatically when exceptions are disabled (-fno-exceptions, /EHs-c-). try_format_to() is unaffected since it never
+ *   throws or reports its errors in the first place.
+ * - AF_NO_LOCALE: drops every use of std::locale and the iostreams std::put_time() needs, along with the overloads that take a locale. The 'L' flag is
+ *   still accepted but always formats with the classic locale's conventions.
+ *********************************************************************************************************************************************************/
+#if !defined(AF_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(_CPPUNWIND)
+	#define AF_NO_EXCEPTIONS
+#endif
+
+#if !defined(AF_NO_LOCALE)
+	#include <iomanip>
+	#include <locale>
+	#include <ostream>
+	#include <streambuf>
+#endif
+
+// Marks the error reporting path as unlikely so it's kept out of line (and out of the hot path's instruction cache) instead of being inlined into every
+// Verify*() function
+#if defined(__GNUC__) || defined(__clang__)
+	#define AF_COLD [[gnu::cold]]
+#elif defined(_MSC_VER)
+	#define AF_COLD __declspec(noinline)
+#else
+	#define AF_COLD
+#endif
 
 using namespace formatter::msg_details;
 namespace formatter {
@@ -35,6 +73,11 @@ namespace formatter {
 			invalid_ctime_spec,
 			missing_ctime_spec,
 			invalid_codepoint,
+			sink_open_failed,
+			sink_map_failed,
+			sink_write_failed,
+			binary_log_corrupt,
+			invalid_range_spec,
 		};
 
 		struct error_handler
@@ -45,18 +88,25 @@ namespace formatter {
 			  public:
 				inline explicit format_error(const char* message): std::runtime_error(message) { }
 				inline explicit format_error(const std::string& message): std::runtime_error(message) { }
+				inline format_error(ErrorType code, const char* message): std::runtime_error(message), err(code) { }
 				inline format_error(const format_error&)            = default;
 				inline format_error& operator=(const format_error&) = default;
 				inline format_error(format_error&&)                 = default;
 				inline format_error& operator=(format_error&&)      = default;
 				inline ~format_error() noexcept override            = default;
+				[[nodiscard]] inline ErrorType code() const noexcept {
+					return err;
+				}
+
+			  private:
+				ErrorType err { ErrorType::none };
 			};
 
-			static constexpr std::array<const char*, 20> format_error_messages = {
+			static constexpr std::array<const char*, 25> format_error_messages = {
 				"Unkown Formatting Error Occured.",
 				"Missing Closing '}' In Argument Spec Field.",
 				"Error In Position Field: No ':' Or '}' Found While In Automatic Indexing Mode.",
-				"Error In Postion Field: Cannot Mix Manual And Automatic Indexing For Arguments."
+				"Error In Postion Field: Cannot Mix Manual And Automatic Indexing For Arguments.",
 				"Error In Position Field: Missing Positional Argument Before ':' In Manual Indexing Mode.",
 				"Formatting Error Detected: Missing ':' Before Next Specifier.",
 				"Error In Position Argument Field: Max Position (24) Exceeded.",
@@ -73,8 +123,62 @@ namespace formatter {
 				"Error In Format: Invalid Time Specifier For C-Time Type Argument.",
 				"Error In Format: Missing C-Time Specifier After '%'.",
 				"Error In Decoding Character Set: Illegal Code Point Present In Code Unit",
+				"Error In Sink: Unable To Open The Output File.",
+				"Error In Sink: Unable To Map Or Grow The Output File Region.",
+				"Error In Sink: Unable To Write To The Output File.",
+				"Error In Binary Log: File Is Truncated Or Is Not An ArgFormatter Binary Log.",
+				"Error In Format: Invalid Range Specifier; Expected An Optional 'n' Followed By An Optional ':' And Element Spec (Or 'x', 'X', 'h', 'H', 'b64' For Bytes).",
 			};
-			[[noreturn]] constexpr void ReportError(ErrorType err);
+			[[noreturn]] AF_COLD inline void ReportError(ErrorType err);
+			// Used by the format string's parsing functions in place of ReportError(). While 'collecting' (see try_format_to()) the first error is kept
+			// in 'error' rather than reported, and the function that found it returns so that its callers can unwind once they see 'failed'
+			AF_COLD inline constexpr void ReportParseError(ErrorType err);
+
+			bool collecting { false };
+			bool failed { false };
+			ErrorType error { ErrorType::none };
+		};
+
+		// What ReportError() hands an error to, in place of throwing it, when built with AF_NO_EXCEPTIONS. Formatting can't carry on past an error, so
+		// the process is aborted if the callback returns
+		using error_callback = void (*)(ErrorType err, const char* message);
+		// Writes the message to stderr; the callback used until one is set
+		inline void PrintError(ErrorType err, const char* message);
+		// Sets the callback used from then on (nullptr puts PrintError back) and returns the previous one
+		inline error_callback SetErrorCallback(error_callback callback);
+		inline std::atomic<error_callback>& ErrorCallback();
+
+		// Outcome of the try_format_to() functions, shaped like std::expected<size_t, ErrorType>: either the number of characters written or the error
+		// that stopped formatting
+		class format_result
+		{
+		  public:
+			constexpr format_result(size_t count) noexcept: written(count) { }
+			// 'none' is kept as the code of a failure that had no specific error (its message is the generic "Unkown Formatting Error" one)
+			constexpr format_result(ErrorType code, size_t count) noexcept: written(count), err(code), failed(true) { }
+
+			[[nodiscard]] constexpr bool has_value() const noexcept {
+				return !failed;
+			}
+			[[nodiscard]] constexpr explicit operator bool() const noexcept {
+				return has_value();
+			}
+			// The characters written, which for a failed call is what was left in the container (see try_format_to())
+			[[nodiscard]] constexpr size_t value() const noexcept {
+				return written;
+			}
+			[[nodiscard]] constexpr ErrorType error() const noexcept {
+				return err;
+			}
+			[[nodiscard]] constexpr const char* message() const noexcept {
+				auto index { static_cast<size_t>(err) };
+				return error_handler::format_error_messages[ index < error_handler::format_error_messages.size() ? index : 0 ];
+			}
+
+		  private:
+			size_t written { 0 };
+			ErrorType err { ErrorType::none };
+			bool failed { false };
 		};
 	}    // namespace af_errors
 }    // namespace formatter
@@ -100,8 +204,23 @@ namespace formatter::globals {
 namespace formatter::arg_formatter {
 
 	constexpr size_t AF_ARG_BUFFER_SIZE { 66 };
+	// Size of the stack block numeric ranges are converted into before being written out
+	constexpr size_t AF_RANGE_BLOCK_SIZE { 4096 };
+	// Bytes shown per line by the 'h'/'H' byte range specs, matching 'hexdump -C'
+	constexpr size_t AF_HEXDUMP_LINE_WIDTH { 16 };
+	// Largest precision the 'f'/'F' specs are written without std::to_chars() for (when the scaled value fits in 64 bits)
+	constexpr int AF_FIXED_FAST_PRECISION { 9 };
+#if !defined(AF_NO_LOCALE)
+	using locale_type = std::locale;
 	// defualt locale used for when no locale is provided, yet a locale flag is present when formatting
 	static std::locale default_locale { std::locale("") };
+#else
+	// Stand-in for std::locale so the internal formatting paths keep a single signature; nothing is ever read from it
+	struct locale_type
+	{
+	};
+	static constexpr locale_type default_locale {};
+#endif
 
 	enum class Alignment : char
 	{
@@ -131,12 +250,40 @@ namespace formatter::arg_formatter {
 		localized,
 	};
 
+#if !defined(AF_NO_LOCALE)
+	// Stream buffer over storage the caller owns: writes land directly in 'storage', which is only grown when a write doesn't fit, so a stream
+	// can be built over it on the stack for each use while the storage (and its capacity) is kept around between uses
+	template<typename CharT> class scratch_streambuf: public std::basic_streambuf<CharT>
+	{
+		using int_type    = typename std::basic_streambuf<CharT>::int_type;
+		using traits_type = typename std::basic_streambuf<CharT>::traits_type;
+
+	  public:
+		explicit scratch_streambuf(std::vector<CharT>& buffer);
+		scratch_streambuf(const scratch_streambuf&)            = delete;
+		scratch_streambuf& operator=(const scratch_streambuf&) = delete;
+		~scratch_streambuf()                                   = default;
+
+		[[nodiscard]] std::basic_string_view<CharT> view() const;
+
+	  protected:
+		int_type overflow(int_type ch) override;
+
+	  private:
+		std::vector<CharT>& storage;
+	};
+#endif
+
 	struct TimeSpecs
 	{
 		inline constexpr void Reset();
 		std::array<LocaleFormat, 25> timeSpecFormat {};
 		std::array<unsigned char, 25> timeSpecContainer {};
 		std::vector<unsigned char> localizationBuff {};
+#if !defined(AF_NO_LOCALE)
+		// what std::put_time() writes the localized time into before it's encoded into 'localizationBuff'
+		std::vector<utf_utils::u_wchar> localizationScratch {};
+#endif
 		int timeSpecCounter { 0 };
 	};
 
@@ -156,13 +303,17 @@ namespace formatter::arg_formatter {
 		unsigned char nestedWidthArgPos { 0 };
 		unsigned char nestedPrecArgPos { 0 };
 		Alignment align { Alignment::Empty };
-		unsigned char fillCharacter { '\0' };
+		// any single code point, stored as its 1 to 4 byte UTF-8 sequence
+		std::array<char, 4> fillCharacter { '\0', '\0', '\0', '\0' };
+		unsigned char fillSize { 0 };
 		unsigned char typeSpec { '\0' };
 		std::string_view preAltForm { "" };
 		Sign signType { Sign::Empty };
 		bool localize { false };
 		bool hasAlt { false };
 		bool hasClosingBrace { false };
+		// the '0' flag: numbers are padded with zeros placed after their sign and base prefix instead of with the fill
+		bool zeroPad { false };
 	};
 
 	struct BracketSearchResults
@@ -179,6 +330,28 @@ namespace formatter::arg_formatter {
 		size_t endPos { 0 };
 	};
 
+	enum class CompiledFieldKind : unsigned char
+	{
+		Literal = 0,
+		Simple,        // '{}' or '{n}'
+		SimpleTime,    // '{}' or '{n}' for a std::tm argument
+		Spec,          // a field whose specs were parsed once and are reused as-is
+		Time,          // a std::tm field with time specs; these are re-parsed per row since the time specs live in 'timeSpec' rather than the field specs
+		Custom,        // handed to the custom formatter every time since the specs are its to parse
+		Range,         // a range field; its specs are only split apart when it's formatted, so 'text' is kept instead
+	};
+
+	// One piece of a format string that was parsed ahead of time so that a batch of rows can be formatted without parsing it again for every row
+	struct CompiledField
+	{
+		CompiledFieldKind kind { CompiledFieldKind::Literal };
+		SpecType argType { SpecType::MonoType };
+		std::string_view text {};
+		size_t parsePos { 0 };
+		int argIndex { 0 };    // where automatic indexing was at when this field was parsed, restored when a field has to be re-parsed
+		SpecFormatting specs {};
+	};
+
 	template<typename... Args> static constexpr void ReserveCapacityImpl(size_t& totalSize, Args&&... args) {
 		size_t unreservedSize {};
 		(
@@ -233,27 +406,52 @@ namespace formatter::arg_formatter {
 		inline constexpr ~ArgFormatter()                              = default;
 
 		// clang-format off
+#if !defined(AF_NO_LOCALE)
 		template<typename T, typename... Args> constexpr void format_to(std::back_insert_iterator<T>&& Iter, const std::locale& loc, std::string_view sv, Args&&... args);
-		template<typename T, typename... Args> constexpr void format_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, Args&&... args);
 		template<typename... Args> [[nodiscard]] std::string format(const std::locale& locale, std::string_view sv, Args&&... args);
+#endif
+		template<typename T, typename... Args> constexpr void format_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, Args&&... args);
 		template<typename... Args> [[nodiscard]] std::string format(std::string_view sv, Args&&... args);
+		// Non-throwing format_to(): an error in the format string is returned rather than thrown and the container is rolled back to the size it had before
+		// the call (a container that can't be resized is left with what was written before the field that failed). Nothing is thrown or unwound for it, so
+		// this is also available with AF_NO_EXCEPTIONS. Not covered: a CustomFormatter's own errors (including those of format calls it makes through a
+		// different formatter than this one) and failures that aren't formatting errors, such as std::bad_alloc.
+#if !defined(AF_NO_LOCALE)
+		template<typename T, typename... Args> [[nodiscard]] af_errors::format_result try_format_to(std::back_insert_iterator<T>&& Iter, const std::locale& loc, std::string_view sv, Args&&... args);
+#endif
+		template<typename T, typename... Args> [[nodiscard]] af_errors::format_result try_format_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, Args&&... args);
+		// Replays a deferred ArgRecord through the usual parsing and formatting path
+		template<typename T> void format_record_to(std::back_insert_iterator<T>&& Iter, const msg_details::ArgRecordView& record);
+		[[nodiscard]] inline std::string format_record(const msg_details::ArgRecordView& record);
+		// Formats every row (a tuple of arguments) of 'rows' with 'sv', parsing 'sv' only once against the first row's argument types
+		template<typename T, typename Rows> void format_rows_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, const Rows& rows);
+		// Struct-of-arrays version of format_rows_to(); row 'i' is made up of element 'i' of every column
+		template<typename T, typename... Columns> void format_columns_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, const Columns&... columns);
 		// clang-format on
 		// useful if overriding how a custom formatter specialization is used if it doesn't call
 		// another "format" type function call -> more of a handshake than anything else
 		inline constexpr void EnableCustomFmtProc(bool enable = true);
 		inline constexpr bool IsCustomFmtProcActive();
 		template<typename T, typename U>
-		requires utf_utils::utf_constraints::IsSupportedUSource<T> && utf_utils::utf_constraints::IsSupportedUContainer<U>
+		requires utf_utils::utf_constraints::IsSupportedUSource<T> &&
+		         (utf_utils::utf_constraints::IsSupportedUContainer<U> || formatter::internal_helper::af_concepts::is_format_sink_v<U>)
 		constexpr void WriteToContainer(T&& buff, size_t endPos, U&& container);
 
 	  private:
 		template<typename Iter, typename... Args> constexpr auto CaptureArgs(Iter&& iter, Args&&... args) -> decltype(iter);
+		// Runs 'formatting' (a format_to() call) with errHandle collecting errors and turns one into a format_result, leaving the container as
+		// try_format_to() describes
+		template<typename T, typename Formatting> af_errors::format_result TryFormat(std::back_insert_iterator<T>&& Iter, Formatting&& formatting);
 		// At the moment ParseFormatString() and Format() are coupled together where ParseFormatString calls Format, hence the need
 		// right now to have a version of ParseFormatString() that takes a locale object to forward to the locale overloaded Format()
 		template<typename T> constexpr void ParseFormatString(std::back_insert_iterator<T>&& Iter, std::string_view sv);
-		template<typename T> constexpr void ParseFormatString(std::back_insert_iterator<T>&& Iter, const std::locale& loc, std::string_view sv);
+		template<typename T> constexpr void ParseFormatString(std::back_insert_iterator<T>&& Iter, const locale_type& loc, std::string_view sv);
+		// Batch formatting: the parse half of ParseFormatString() recorded into 'compiledFields' and the format half replayed from it
+		inline void CompileFormatString(std::string_view sv);
+		template<typename T> void FormatCompiled(T&& container);
+		template<typename T, typename RowCapture> void FormatBatch(T& container, std::string_view sv, size_t rowCount, RowCapture&& captureRow);
 		template<typename T> constexpr void Format(T&& container, const SpecType& argType);
-		template<typename T> constexpr void Format(T&& container, const std::locale& loc, const SpecType& argType);
+		template<typename T> constexpr void Format(T&& container, const locale_type& loc, const SpecType& argType);
 		/******************************************************* Parsing/Verification Related Functions *******************************************************/
 		inline constexpr bool FindBrackets(std::string_view sv);
 		inline constexpr void Parse(std::string_view sv, size_t& currentPosition, const SpecType& argType);
@@ -269,17 +467,22 @@ namespace formatter::arg_formatter {
 		inline constexpr void VerifyLocaleField(size_t& currentPosition, const SpecType& argType);
 		inline constexpr void HandlePotentialTypeField(const char& ch, const SpecType& argType);
 		inline constexpr bool IsSimpleSubstitution(const SpecType& argType, const int& precision);
-		inline constexpr void OnAlignLeft(const char& ch, size_t& pos);
-		inline constexpr void OnAlignRight(const char& ch, size_t& pos);
-		inline constexpr void OnAlignCenter(const char& ch, size_t& pos);
-		inline constexpr void OnAlignDefault(const SpecType& type, size_t& pos);
+		inline constexpr void OnAlignLeft(std::string_view fill, size_t& pos);
+		inline constexpr void OnAlignRight(std::string_view fill, size_t& pos);
+		inline constexpr void OnAlignCenter(std::string_view fill, size_t& pos);
+		inline constexpr void OnAlignDefault(const SpecType& type);
+		inline constexpr void SetFillCharacter(std::string_view fill);
 		inline constexpr void OnValidTypeSpec(const SpecType& type, const char& ch);
 		inline constexpr void OnInvalidTypeSpec(const SpecType& type);
 		/************************************************************ Formatting Related Functions ************************************************************/
 		template<typename T> constexpr void FormatStringType(T&& container, std::string_view val, const int& precision);
+		template<typename T> constexpr void WriteReferenceToContainer(std::string_view sv, size_t size, T&& container);
 		inline constexpr void FormatArgument(const int& precision, const SpecType& type);
 		template<typename T> constexpr void FormatAlignment(T&& container, const int& totalWidth);
 		template<typename T> constexpr void FormatAlignment(T&& container, std::string_view val, const int& width, int prec);
+		template<typename T>
+		constexpr void FormatZeroPadded(T&& container, const locale_type& loc, const SpecType& type, const int& totalWidth, const int& precision);
+		inline constexpr bool IsZeroPaddable(const SpecType& type);
 		inline constexpr void FormatBoolType(const bool& value);
 		inline constexpr void FormatCharType(const char& value);
 		template<typename T>
@@ -296,9 +499,9 @@ namespace formatter::arg_formatter {
 		requires std::is_integral_v<std::remove_cvref_t<T>>
 		constexpr void TwoDigitToBuff(T&& val);
 		template<typename T> constexpr void FormatTimeField(T&& container);
-		template<typename T> constexpr void FormatTimeField(T&& container, const std::locale& loc);
+		template<typename T> constexpr void FormatTimeField(T&& container, const locale_type& loc);
 		inline constexpr void FormatCTime(const std::tm& cTimeStruct, const int& precision, int startPos = 0, int endPos = 0);
-		inline void LocalizeCTime(const std::locale& loc, const std::tm& timeStruct, const int& precision);
+		inline void LocalizeCTime(const locale_type& loc, const std::tm& timeStruct, const int& precision);
 		template<typename T> constexpr void WriteSimpleCTime(T&& container);
 		template<typename T> constexpr void Write24HourTime(T&& container, const int& hour, const int& min, const int& sec);
 		template<typename T> constexpr void WriteShortMonth(T&& container, const int& mon);
@@ -365,20 +568,30 @@ namespace formatter::arg_formatter {
 		inline constexpr void FormatWkday_DDMMMYY_Time(const std::tm& time, int precision = 0);
 
 		//  NOTE: Due to the usage of the numpunct functions, which are not constexpr, these functions can't really be specified as constexpr
+		inline void LocalizeArgument(const locale_type& loc, const int& precision, const SpecType& type);
+#if !defined(AF_NO_LOCALE)
 		inline void LocalizeBool(const std::locale& loc);
-		inline void FormatIntegralGrouping(const std::locale& loc, size_t end);
-		inline void LocalizeArgument(const std::locale& loc, const int& precision, const SpecType& type);
+		// Inserts the locale's separators into the digits in [0, end) of 'buffer' and returns where those digits now end
+		inline size_t FormatIntegralGrouping(const std::locale& loc, size_t end);
 		inline void LocalizeIntegral(const std::locale& loc, const int& precision, const SpecType& type);
 		inline void LocalizeFloatingPoint(const std::locale& loc, const int& precision, const SpecType& type);
+#endif
 		/******************************************************** Container Writing Related Functions *********************************************************/
 		inline constexpr void BufferToUpper(char* begin, const char* end);
-		inline constexpr void FillBuffWithChar(const int& totalWidth);
+		// Writes 'count' copies of the fill character to 'dest', doubling the copied run each time
+		inline constexpr void FillPattern(char* dest, size_t count);
 		inline constexpr void SetIntegralFormat(int& base, bool& isUpper);
 		inline constexpr void SetFloatingFormat(std::chars_format& format, int& precision, bool& isUpper);
 		inline constexpr void WriteChar(const char& value);
 		inline constexpr void WriteBool(const bool& value);
 		template<typename T> constexpr void WriteFormattedString(T&& container, const SpecType& type, const int& precisionFormatted);
 		template<typename T> constexpr void WriteSimpleValue(T&& container, const SpecType&);
+		template<typename T> constexpr void FormatRange(T&& container, std::string_view spec);
+		template<typename T> constexpr void FormatByteRange(T&& container, std::string_view spec, const internal_helper::RangeValue& range);
+		template<typename T> constexpr void WriteJsonEscaped(T&& container, std::string_view val);
+		template<typename T> constexpr void WriteDebugEscaped(T&& container, std::string_view val, char delimiter);
+		inline constexpr void WriteDebugChar(const char& value);
+		template<typename T> constexpr void FormatEscapedAlignment(T&& container, const SpecType& type, const int& totalWidth, const int& precision);
 		template<typename T> constexpr void WriteSimpleString(T&& container);
 		template<typename T> constexpr void WriteSimpleCString(T&& container);
 		template<typename T> constexpr void WriteSimpleStringView(T&& container);
@@ -394,13 +607,16 @@ namespace formatter::arg_formatter {
 		template<typename T> constexpr void WriteSimpleVoidPtr(T&& container);
 
 		// clang-format off
-		template<typename T> constexpr void WriteAlignedLeft(T&& container, const int& totalWidth);
-		template<typename T>constexpr void WriteAlignedLeft(T&& container, std::string_view val, const int& precision, const int& totalWidth);
-		template<typename T> constexpr void WriteAlignedRight(T&& container, const int& totalWidth, const size_t& fillAmount);
-		template<typename T>constexpr void WriteAlignedRight(T&& container, std::string_view val, const int& precision, const int& totalWidth, const size_t& fillAmount);
-		template<typename T> constexpr void WriteAlignedCenter(T&& container, const int& totalWidth, const size_t& fillAmount);
-		template<typename T>constexpr void WriteAlignedCenter(T&& container, std::string_view val, const int& precision, const int& totalWidth, const size_t& fillAmount);
-		template<typename T>constexpr void WriteSimplePadding(T&& container, const size_t& fillAmount);
+		// Writes 'before' fill characters, 'val' and then 'after' fill characters straight into the container
+		template<typename T> constexpr void WriteAligned(T&& container, std::string_view val, const size_t& before, const size_t& after);
+		template<typename T> constexpr void WriteSimplePadding(T&& container, const size_t& fillAmount);
+		// Writes the staged value with zeros between its first 'prefixSize' bytes (the sign and base prefix) and the rest of it
+		template<typename T> constexpr void WriteZeroPadded(T&& container, const int& totalWidth, size_t prefixSize);
+		// How much of the staged value the zeros go after: its sign plus the base prefix of an alternate form or a pointer
+		inline size_t ZeroPadPrefixSize(const SpecType& argType);
+		// Writes the sign, base prefix, zeros and digits of 'value' straight into char strings and vectors; only the unpadded value is staged otherwise
+		template<typename T, typename V> requires std::is_integral_v<std::remove_cvref_t<V>>
+			constexpr void WriteZeroPaddedInteger(T&& container, V&& value, const int& totalWidth);
 
 		template<typename T> constexpr void WriteNonAligned(T&& container);
 		template<typename T> constexpr void WriteNonAligned(T&& container, std::string_view val, const int& precision);
@@ -422,21 +638,26 @@ namespace formatter::arg_formatter {
 		formatter::af_errors::error_handler errHandle;
 		TimeSpecs timeSpec {};
 		int lastRootCounter;
+		std::vector<CompiledField> compiledFields {};
+		// escaped strings that also need aligning or truncating are escaped here first since escaping changes their width
+		std::string escapedText {};
 	};
 
 #include "ArgFormatterImpl.h"
 }    // namespace formatter::arg_formatter
 
 // These are made static so that when including this file, one can either use and modify the above class or just call the
-// formatting functions directly, like the logger-side of this project where the VFORMAT_TO macros are defined
+// formatting functions directly, like the logger-side of this project where the VFORMAT_TO macros are defined.
+// The instance is per thread so that nested format_to() calls from a CustomFormatter running on a batch worker (or any other thread)
+// don't share parsing state with other threads.
 namespace formatter {
 	namespace globals {
-		inline static std::unique_ptr<arg_formatter::ArgFormatter> staticFormatter { std::make_unique<arg_formatter::ArgFormatter>() };
+		inline static thread_local std::unique_ptr<arg_formatter::ArgFormatter> staticFormatter { std::make_unique<arg_formatter::ArgFormatter>() };
 	}    // namespace globals
 
 	namespace custom_helper {
 
-		inline static bool [[nodiscard]] IsCustomFmtProcActive() {
+		[[nodiscard]] inline static bool IsCustomFmtProcActive() {
 			return globals::staticFormatter->IsCustomFmtProcActive();
 		}
 
@@ -445,7 +666,8 @@ namespace formatter {
 		}
 
 		template<typename T, typename U>
-		requires utf_utils::utf_constraints::IsSupportedUSource<T> && utf_utils::utf_constraints::IsSupportedUContainer<U>
+		requires utf_utils::utf_constraints::IsSupportedUSource<T> &&
+		         (utf_utils::utf_constraints::IsSupportedUContainer<U> || formatter::internal_helper::af_concepts::is_format_sink_v<U>)
 		constexpr void WriteToContainer(T&& buff, size_t size, U&& cont) {
 			globals::staticFormatter->WriteToContainer(std::forward<T>(buff), size, std::forward<U>(cont));
 		}
@@ -456,10 +678,25 @@ namespace formatter {
 		globals::staticFormatter->format_to(std::move(Iter), sv, std::forward<Args>(args)...);
 	}
 
+#if !defined(AF_NO_LOCALE)
 	template<typename T, typename... Args>
 	static constexpr void format_to(std::back_insert_iterator<T>&& Iter, const std::locale& locale, std::string_view sv, Args&&... args) {
 		globals::staticFormatter->format_to(std::move(Iter), locale, sv, std::forward<Args>(args)...);
 	}
+#endif
+
+	template<typename T, typename... Args>
+	[[nodiscard]] static af_errors::format_result try_format_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, Args&&... args) {
+		return globals::staticFormatter->try_format_to(std::move(Iter), sv, std::forward<Args>(args)...);
+	}
+
+#if !defined(AF_NO_LOCALE)
+	template<typename T, typename... Args>
+	[[nodiscard]] static af_errors::format_result try_format_to(std::back_insert_iterator<T>&& Iter, const std::locale& locale, std::string_view sv,
+	                                                            Args&&... args) {
+		return globals::staticFormatter->try_format_to(std::move(Iter), locale, sv, std::forward<Args>(args)...);
+	}
+#endif
 
 	template<typename... Args> [[nodiscard]] static std::string format(std::string_view sv, Args&&... args) {
 		std::string tmp;
@@ -468,39 +705,74 @@ namespace formatter {
 		return tmp;
 	}
 
+#if !defined(AF_NO_LOCALE)
 	template<typename... Args> [[nodiscard]] static std::string format(const std::locale& locale, std::string_view sv, Args&&... args) {
 		std::string tmp;
 		tmp.reserve(formatter::arg_formatter::ReserveCapacity(std::forward<Args>(args)...));
 		globals::staticFormatter->format_to(std::move(std::back_inserter(tmp)), locale, sv, std::forward<Args>(args)...);
 		return tmp;
 	}
+#endif
+
+	template<typename T> static void format_record_to(std::back_insert_iterator<T>&& Iter, const msg_details::ArgRecordView& record) {
+		globals::staticFormatter->format_record_to(std::move(Iter), record);
+	}
+
+	[[nodiscard]] inline std::string format_record(const msg_details::ArgRecordView& record) {
+		return globals::staticFormatter->format_record(record);
+	}
+
+	// Formats 'range' with 'separator' between its elements and wrapped in 'opening'/'closing' rather than the default "[a, b, c]"; since only a view of
+	// the range is captured, the range and the strings given here must outlive the formatting call
+	template<typename Range>
+	requires internal_helper::af_concepts::is_formattable_range_v<Range>
+	[[nodiscard]] constexpr internal_helper::RangeValue join(const Range& range, std::string_view separator, std::string_view opening = "",
+	                                                         std::string_view closing = "") {
+		return msg_details::MakeRangeValue(range, separator, opening, closing);
+	}
+
+	template<typename T, typename Rows> static void format_rows_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, const Rows& rows) {
+		globals::staticFormatter->format_rows_to(std::move(Iter), sv, rows);
+	}
+
+	template<typename T, typename... Columns>
+	static void format_columns_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, const Columns&... columns) {
+		globals::staticFormatter->format_columns_to(std::move(Iter), sv, columns...);
+	}
 
 	// Now that the runtime errors are organized in a neater fashion, would really love to figure out how libfmt does compile-time checking.
 	// A lot of what is being used to verify things are all runtime-access stuff so I'm assuming achieving this won't be easy at all =/
-	constexpr void formatter::af_errors::error_handler::ReportError(ErrorType err) {
-		using enum ErrorType;
-		switch( err ) {
-				case missing_bracket: throw format_error(format_error_messages[ 1 ]); break;
-				case position_field_spec: throw format_error(format_error_messages[ 2 ]); break;
-				case position_field_mode: throw format_error(format_error_messages[ 3 ]); break;
-				case position_field_no_position: throw format_error(format_error_messages[ 4 ]); break;
-				case position_field_runon: throw format_error(format_error_messages[ 5 ]); break;
-				case max_args_exceeded: throw format_error(format_error_messages[ 6 ]); break;
-				case invalid_fill_character: throw format_error(format_error_messages[ 7 ]); break;
-				case invalid_alt_type: throw format_error(format_error_messages[ 8 ]); break;
-				case invalid_precision_type: throw format_error(format_error_messages[ 9 ]); break;
-				case invalid_locale_type: throw format_error(format_error_messages[ 10 ]); break;
-				case invalid_int_spec: throw format_error(format_error_messages[ 11 ]); break;
-				case invalid_float_spec: throw format_error(format_error_messages[ 12 ]); break;
-				case invalid_string_spec: throw format_error(format_error_messages[ 13 ]); break;
-				case invalid_bool_spec: throw format_error(format_error_messages[ 14 ]); break;
-				case invalid_char_spec: throw format_error(format_error_messages[ 15 ]); break;
-				case invalid_pointer_spec: throw format_error(format_error_messages[ 16 ]); break;
-				case invalid_ctime_spec: throw format_error(format_error_messages[ 17 ]); break;
-				case missing_ctime_spec: throw format_error(format_error_messages[ 18 ]); break;
-				case invalid_codepoint: throw format_error(format_error_messages[ 19 ]); break;
-				default: throw format_error(format_error_messages[ 0 ]); break;
-			}
+	// The messages are laid out in the same order as ErrorType, so the error indexes straight into them
+	inline void formatter::af_errors::error_handler::ReportError(ErrorType err) {
+		auto index { static_cast<size_t>(err) };
+		auto message { format_error_messages[ index < format_error_messages.size() ? index : 0 ] };
+#if !defined(AF_NO_EXCEPTIONS)
+		throw format_error(err, message);
+#else
+		ErrorCallback().load(std::memory_order_acquire)(err, message);
+		std::abort();
+#endif
+	}
+
+	inline constexpr void formatter::af_errors::error_handler::ReportParseError(ErrorType err) {
+		if( !collecting ) ReportError(err);
+		if( !failed ) {
+				failed = true;
+				error  = err;
+		}
+	}
+
+	inline void formatter::af_errors::PrintError(ErrorType, const char* message) {
+		std::fprintf(stderr, "ArgFormatter Error: %s\n", message);
+	}
+
+	inline formatter::af_errors::error_callback formatter::af_errors::SetErrorCallback(error_callback callback) {
+		return ErrorCallback().exchange(callback != nullptr ? callback : PrintError, std::memory_order_acq_rel);
+	}
+
+	inline std::atomic<formatter::af_errors::error_callback>& formatter::af_errors::ErrorCallback() {
+		static std::atomic<error_callback> callback { PrintError };
+		return callback;
 	}
 
 }    // namespace formatter
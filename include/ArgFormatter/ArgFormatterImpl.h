@@ -23,20 +23,220 @@ static constexpr bool IsAlpha(const char& ch) {
 	return ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z'));
 }
 
+// The number of digits std::to_chars() writes for 'value' in 'base' (2, 8, 10 or 16)
+template<typename T> static constexpr size_t CountDigits(T value, int base) {
+	static_assert(std::is_unsigned_v<T>);
+	if( base != 10 ) {
+			auto bitsPerDigit { base == 16 ? 4 : base == 8 ? 3 : 1 };
+			return value == 0 ? 1 : static_cast<size_t>((std::bit_width(value) + bitsPerDigit - 1) / bitsPerDigit);
+	}
+	size_t digits { 1 };
+	for( ;; ) {
+			if( value < 10 ) return digits;
+			if( value < 100 ) return digits + 1;
+			if( value < 1000 ) return digits + 2;
+			if( value < 10000 ) return digits + 3;
+			value /= 10000;
+			digits += 4;
+		}
+}
+
+// Both digits of every value from 0 to 99
+static constexpr std::array<char, 200> decimalPairs { [] {
+	std::array<char, 200> pairs {};
+	for( size_t value { 0 }; value < 100; ++value ) {
+			pairs[ value * 2 ]     = static_cast<char>('0' + value / 10);
+			pairs[ value * 2 + 1 ] = static_cast<char>('0' + value % 10);
+		}
+	return pairs;
+}() };
+
+// Writes exactly 'digits' decimal digits of 'value' to 'dest', two at a time from right to left, and returns one past the last one
+static char* WriteDecimalDigits(uint64_t value, size_t digits, char* dest) {
+	auto end { dest + digits };
+	auto pos { end };
+	for( ; pos - dest >= 2; value /= 100 ) {
+			pos -= 2;
+			std::memcpy(pos, decimalPairs.data() + (value % 100) * 2, 2);
+		}
+	if( pos != dest ) *--pos = static_cast<char>('0' + value % 10);
+	return end;
+}
+
+static constexpr void Multiply64To128(uint64_t a, uint64_t b, uint64_t& high, uint64_t& low) {
+	auto aLow { a & 0xFFFF'FFFF }, aHigh { a >> 32 }, bLow { b & 0xFFFF'FFFF }, bHigh { b >> 32 };
+	auto lowLow { aLow * bLow }, lowHigh { aLow * bHigh }, highLow { aHigh * bLow };
+	auto middle { (lowLow >> 32) + (lowHigh & 0xFFFF'FFFF) + (highLow & 0xFFFF'FFFF) };
+	low  = (lowLow & 0xFFFF'FFFF) | (middle << 32);
+	high = aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+}
+
+/*********************************************************************************************************************************************************
+ * Writes 'value' the way std::to_chars(..., std::chars_format::fixed, precision) does and returns one past the last char written, or nullptr (having
+ * written nothing) when the value isn't finite, the precision is above AF_FIXED_FAST_PRECISION or the value scaled by 10^precision doesn't fit in 64 bits.
+ * A double is exactly mantissa * 2^exponent, so value * 10^precision is exactly mantissa * 5^precision / 2^(-exponent - precision): the product is
+ * taken in 128 bits and then split into the quotient and the remainder of that power of two, which decides the rounding exactly (ties go to the even
+ * digit, just as they do for std::to_chars()). The scaled integer is then written with the digit pair table on both sides of the decimal point.
+ *********************************************************************************************************************************************************/
+static char* WriteFixedPrecision(double value, int precision, char* dest) {
+	constexpr uint64_t powersOfFive[] { 1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125 };
+	constexpr uint64_t powersOfTen[] { 1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000, 1'000'000'000 };
+	static_assert(std::size(powersOfFive) == formatter::arg_formatter::AF_FIXED_FAST_PRECISION + 1);
+	if( precision < 1 || precision > formatter::arg_formatter::AF_FIXED_FAST_PRECISION ) return nullptr;
+	auto bits { std::bit_cast<uint64_t>(value) };
+	auto biasedExponent { static_cast<int>((bits >> 52) & 0x7FF) };
+	if( biasedExponent == 0x7FF ) return nullptr;
+	auto mantissa { bits & 0x000F'FFFF'FFFF'FFFF };
+	// subnormals have the same exponent as the smallest normal value, just without the implicit bit
+	biasedExponent != 0 ? static_cast<void>(mantissa |= 0x0010'0000'0000'0000) : static_cast<void>(biasedExponent = 1);
+	auto shift { 1075 - biasedExponent - precision };
+	uint64_t high, low, scaled;
+	Multiply64To128(mantissa, powersOfFive[ precision ], high, low);
+	if( shift <= 0 ) {
+			// an integer already, so it only has to fit once shifted
+			if( high != 0 || shift <= -64 || (shift != 0 && (low >> (64 + shift)) != 0) ) return nullptr;
+			scaled = low << -shift;
+	} else if( shift >= 75 ) {
+			// the product is below 2^74, so it's less than half of 2^shift and rounds down to nothing
+			scaled = 0;
+	} else {
+			uint64_t remainderHigh, remainderLow, halfHigh, halfLow;
+			if( shift < 64 ) {
+					if( (high >> shift) != 0 ) return nullptr;
+					scaled        = (low >> shift) | (high << (64 - shift));
+					remainderHigh = 0;
+					remainderLow  = low & ((uint64_t { 1 } << shift) - 1);
+					halfHigh      = 0;
+					halfLow       = uint64_t { 1 } << (shift - 1);
+			} else {
+					scaled        = high >> (shift - 64);
+					remainderHigh = high & ((uint64_t { 1 } << (shift - 64)) - 1);
+					remainderLow  = low;
+					halfHigh      = shift == 64 ? 0 : uint64_t { 1 } << (shift - 65);
+					halfLow       = shift == 64 ? uint64_t { 1 } << 63 : 0;
+				}
+			auto aboveHalf { remainderHigh > halfHigh || (remainderHigh == halfHigh && remainderLow > halfLow) };
+			auto isHalf { remainderHigh == halfHigh && remainderLow == halfLow };
+			if( aboveHalf || (isHalf && (scaled & 1) != 0) ) {
+					if( scaled == ~uint64_t { 0 } ) return nullptr;
+					++scaled;
+			}
+		}
+	if( std::signbit(value) ) *dest++ = '-';
+	auto integral { scaled / powersOfTen[ precision ] };
+	dest    = WriteDecimalDigits(integral, CountDigits(integral, 10), dest);
+	*dest++ = '.';
+	return WriteDecimalDigits(scaled % powersOfTen[ precision ], static_cast<size_t>(precision), dest);
+}
+
+// Writes exactly 'digits' digits of 'value' in 'base' to 'dest', where 'digits' is what CountDigits() returned, and returns one past the last one
+template<typename T> static char* WriteDigits(T value, int base, size_t digits, char* dest, bool isUpper) {
+	switch( base ) {
+			case 16: return formatter::simd::WriteHexDigits(value, digits, dest, isUpper);
+			case 8: return formatter::simd::WriteOctalDigits(value, digits, dest);
+			case 2: return formatter::simd::WriteBinaryDigits(value, digits, dest);
+			default: return std::to_chars(dest, dest + digits, value, base).ptr;
+		}
+}
+
+// Writes the debug ('?') form of the char or code point at the start of 'val' to 'dest', which must have room for 12 chars, and returns how many chars
+// were written; 'consumed' is set to how many chars of 'val' that covered and 'escaped' to whether it was written as an escape sequence
+static constexpr size_t DebugEscapeSequence(std::string_view val, char delimiter, bool& escaped, size_t& consumed, char* dest) {
+	auto writeEscape { [ & ](char kind, char32_t value) -> size_t {
+		escaped = true;
+		dest[ 0 ] = '\\';
+		dest[ 1 ] = kind;
+		dest[ 2 ] = '{';
+		auto end { std::to_chars(dest + 3, dest + 11, static_cast<uint32_t>(value), 16).ptr };
+		*end = '}';
+		return static_cast<size_t>(end - dest) + 1;
+	} };
+	auto ch { static_cast<unsigned char>(val[ 0 ]) };
+	consumed = 1;
+	if( ch < 0x80 ) {
+			escaped = true;
+			dest[ 0 ] = '\\';
+			switch( ch ) {
+					case '\t': dest[ 1 ] = 't'; return 2;
+					case '\n': dest[ 1 ] = 'n'; return 2;
+					case '\r': dest[ 1 ] = 'r'; return 2;
+					case '\\': dest[ 1 ] = '\\'; return 2;
+					default: break;
+				}
+			if( val[ 0 ] == delimiter ) {
+					dest[ 1 ] = delimiter;
+					return 2;
+			}
+			if( ch < 0x20 || ch == 0x7F ) return writeEscape('u', ch);
+			escaped = false;
+			dest[ 0 ] = val[ 0 ];
+			return 1;
+	}
+	char32_t codePoint {};
+	auto length { formatter::unicode::DecodeUtf8(val, codePoint) };
+	// every byte of an ill-formed sequence is escaped on its own
+	if( length == 0 ) return writeEscape('x', ch);
+	consumed = length;
+	// a combining mark is only written as-is when there's something for it to combine with
+	if( formatter::unicode::IsDebugEscaped(codePoint) || (escaped && formatter::unicode::IsGraphemeExtend(codePoint)) ) return writeEscape('u', codePoint);
+	escaped = false;
+	std::copy_n(val.data(), length, dest);
+	return length;
+}
+
+// The fill character at 'pos': the whole UTF-8 sequence of the code point there, or the ill-formed bytes there if it isn't well-formed
+static constexpr std::string_view FillSequence(std::string_view sv, size_t pos) {
+	char32_t codePoint {};
+	auto length { formatter::unicode::DecodeUtf8(sv.substr(pos), codePoint) };
+	if( length == 0 ) {
+			// an ill-formed sequence is kept together with the continuation bytes after it, so that an alignment following it is still found and
+			// SetFillCharacter() gets to reject the whole thing
+			length = 1;
+			while( length < 4 && pos + length < sv.size() && (static_cast<unsigned char>(sv[ pos + length ]) & 0xC0) == 0x80 ) ++length;
+	}
+	return sv.substr(pos, length);
+}
+
+// Measures the part of 'val' that fits in 'precision' display columns (all of it if there's no precision). ASCII text takes up one column per char, so
+// only the text from the first non-ASCII byte on, if there is one, is decoded and looked up code point by code point (starting right at the cut
+// when the two meet, since a combining mark there still belongs to the text before it).
+static constexpr formatter::unicode::ColumnSpan MeasureDisplayWidth(std::string_view val, int precision) {
+	auto limit { precision > 0 ? static_cast<size_t>(precision) : std::numeric_limits<size_t>::max() };
+	size_t ascii { 0 };
+	if( std::is_constant_evaluated() ) {
+			while( ascii < val.size() && static_cast<unsigned char>(val[ ascii ]) < 0x80 ) ++ascii;
+	} else {
+			ascii = formatter::simd::FindNonAscii(val.data(), val.size());
+		}
+	if( ascii == val.size() || ascii > limit ) {
+			auto size { std::min(val.size(), limit) };
+			return { size, size };
+	}
+	auto span { formatter::unicode::MeasureColumns(val.substr(ascii), limit - ascii) };
+	return { ascii + span.bytes, ascii + span.columns };
+}
+
+// Cuts 'val' down to the part that fits in 'precision' display columns; without a precision there's nothing to cut, so it isn't measured at all
+static constexpr std::string_view TruncateToPrecision(std::string_view val, int precision) {
+	return precision > 0 ? val.substr(0, MeasureDisplayWidth(val, precision).bytes) : val;
+}
+
 using u_char_string = std::basic_string<unsigned char>;
 
+#if !defined(AF_NO_LOCALE)
+// Writes the 'E'/'O' modified conversion for 'ch' into 'dest' and returns the length written
 // Note: there's no distinction made here for the overlapping case of 'Ey' and 'Oy' yet
-static constexpr utf_utils::u_wstring LocalizedFormat(const unsigned char& ch) {
-	utf_utils::u_wstring tmp;
+static constexpr size_t LocalizedFormat(const unsigned char& ch, utf_utils::u_wchar* dest) {
 	switch( ch ) {
 			case 'c': [[fallthrough]];
 			case 'x': [[fallthrough]];
 			case 'C': [[fallthrough]];
 			case 'X': [[fallthrough]];
-			case 'Y': tmp.append(1, 'E').append(1, ch); break;
-			default: tmp.append(1, 'O').append(1, ch); break;
+			case 'Y': dest[ 0 ] = 'E'; break;
+			default: dest[ 0 ] = 'O'; break;
 		}
-	return std::move(tmp);
+	dest[ 1 ] = ch;
+	return 2;
 }
 
 // clang-format off
@@ -56,111 +256,36 @@ inline void formatter::arg_formatter::ArgFormatter::LocalizeBool(const std::loca
 	std::copy(sv.data(), sv.data() + valueSize, buffer.begin());
 }
 
-inline void formatter::arg_formatter::ArgFormatter::FormatIntegralGrouping(const std::locale& loc, size_t end) {
-	auto groupings { std::use_facet<std::numpunct<char>>(loc).grouping() };
-	if( end <= *groupings.begin() ) return;
-	auto separator { std::use_facet<std::numpunct<char>>(loc).thousands_sep() };
-	auto groupBegin { groupings.begin() };
-	int groupGap { *groupBegin };
-	std::string_view sv { buffer.data(), buffer.data() + end };
-	size_t groups { 0 };
-
-	switch( groupings.size() ) {
-			case 3:
-				{
-					// grouping is unique
-					int secondGroup { *(++groupBegin) };
-					int repeatingGroup { *(++groupBegin) };
-					groups = (valueSize - groupGap - secondGroup) / static_cast<size_t>(repeatingGroup) +
-					         (valueSize - groupGap - secondGroup) % static_cast<size_t>(repeatingGroup);
-					auto spaceRequired { valueSize + groups + 1 };    // add one for intermediate grouping
-					valueSize = spaceRequired;
-
-					std::copy(sv.end() - groupGap, sv.end(), buffer.data() + spaceRequired - groupGap);
-					sv.remove_suffix(groupGap);
-					spaceRequired -= groupGap;
-					buffer[ --spaceRequired ] = separator;
-
-					std::copy(sv.end() - secondGroup, sv.end(), buffer.data() + spaceRequired - secondGroup);
-					spaceRequired -= secondGroup;
-					sv.remove_suffix(secondGroup);
-					buffer[ --spaceRequired ] = separator;
-
-					for( ; groups; --groups ) {
-							if( sv.size() > repeatingGroup ) {
-									std::copy(sv.end() - repeatingGroup, sv.end(), buffer.data() + spaceRequired - repeatingGroup);
-									spaceRequired -= repeatingGroup;
-							} else {
-									std::copy(sv.begin(), sv.end() - 1, buffer.begin());
-									return;
-								}
-							if( groups > 0 ) {
-									buffer[ --spaceRequired ] = separator;
-							}
-							if( sv.size() > repeatingGroup ) {
-									sv.remove_suffix(repeatingGroup);
-							}
-						}
-					break;
-				}
-			case 2:
-				{
-					// grouping is one group and then uniform
-					int repeatingGroup { *(++groupBegin) };
-					groups = (valueSize - groupGap) / static_cast<size_t>(repeatingGroup) + (valueSize - groupGap) % static_cast<size_t>(repeatingGroup);
-					auto spaceRequired { valueSize + groups };
-					valueSize = spaceRequired;
-
-					std::copy(sv.end() - groupGap, sv.end(), buffer.data() + spaceRequired - groupGap);
-					sv.remove_suffix(groupGap);
-					spaceRequired -= groupGap;
-					buffer[ --spaceRequired ] = separator;
-
-					for( ; groups; --groups ) {
-							if( sv.size() > repeatingGroup ) {
-									std::copy(sv.end() - repeatingGroup, sv.end(), buffer.data() + spaceRequired - repeatingGroup);
-									spaceRequired -= repeatingGroup;
-							} else {
-									std::copy(sv.begin(), sv.end() - 1, buffer.begin());
-									return;
-								}
-							if( groups > 0 ) {
-									buffer[ --spaceRequired ] = separator;
-							}
-							if( sv.size() > repeatingGroup ) {
-									sv.remove_suffix(repeatingGroup);
-							}
-						}
-					break;
-				}
-			case 1:
-				{
-					// grouping is uniform
-					groups = valueSize / static_cast<size_t>(groupGap) + valueSize % static_cast<size_t>(groupGap);
-					size_t spaceRequired { valueSize + groups - 1 };
-					valueSize = spaceRequired;
-					for( ; groups; --groups ) {
-							if( sv.size() > groupGap ) {
-									std::copy(sv.end() - groupGap, sv.end(), buffer.data() + spaceRequired - groupGap);
-									spaceRequired -= groupGap;    // taking into consideration both the grouping and separator per group
-							} else {
-									std::copy(sv.begin(), sv.end() - 1, buffer.begin());
-									return;
-								}
-							if( groups > 0 ) {
-									buffer[ --spaceRequired ] = separator;
-							}
-							if( sv.size() > groupGap ) {
-									sv.remove_suffix(groupGap);
-							}
-						}
-					break;
-				}
-			default: break;
+inline size_t formatter::arg_formatter::ArgFormatter::FormatIntegralGrouping(const std::locale& loc, size_t end) {
+	auto& punct { std::use_facet<std::numpunct<char>>(loc) };
+	auto groupings { punct.grouping() };
+	// a group size of zero or CHAR_MAX (or running out of group sizes after a non-repeating one) means the remaining digits aren't grouped
+	auto groupSize { [ &groupings ](size_t index) -> size_t {
+		auto size { groupings[ std::min(index, groupings.size() - 1) ] };
+		return size <= 0 || size == std::numeric_limits<char>::max() ? std::numeric_limits<size_t>::max() : static_cast<size_t>(size);
+	} };
+	if( groupings.empty() ) return end;
+	size_t digitsBegin { buffer[ 0 ] == '-' || buffer[ 0 ] == '+' || buffer[ 0 ] == ' ' ? size_t { 1 } : size_t { 0 } };
+	size_t separators { 0 };
+	for( size_t remaining { end - digitsBegin }, group { 0 }; remaining > groupSize(group); remaining -= groupSize(group++) ) ++separators;
+	if( separators == 0 || valueSize + separators > buffer.size() ) return end;
+	// shift anything after the digits (a mantissa, exponent, etc...) over first, then move the digits right to left, dropping in a separator after each group
+	std::copy_backward(buffer.data() + end, buffer.data() + valueSize, buffer.data() + valueSize + separators);
+	auto separator { punct.thousands_sep() };
+	auto src { end }, dest { end + separators };
+	for( size_t group { 0 }, count { 0 }; dest != src; ) {
+			buffer[ --dest ] = buffer[ --src ];
+			if( ++count == groupSize(group) ) {
+					buffer[ --dest ] = separator;
+					count            = 0;
+					++group;
+			}
 		}
+	valueSize += separators;
+	return end + separators;
 }
 
-inline void formatter::arg_formatter::ArgFormatter::LocalizeArgument(const std::locale& loc, const int& precision, const SpecType& type) {
+inline void formatter::arg_formatter::ArgFormatter::LocalizeArgument(const locale_type& loc, const int& precision, const SpecType& type) {
 	using enum formatter::msg_details::SpecType;
 	// NOTE: The following types should have been caught in the verification process:  monostate, string, c-string, string view, const void*, void *
 	switch( type ) {
@@ -172,16 +297,11 @@ inline void formatter::arg_formatter::ArgFormatter::LocalizeArgument(const std::
 			case LongDoubleType: [[fallthrough]];
 			case U_LongLongType: LocalizeFloatingPoint(loc, precision, type); break;
 			case BoolType: LocalizeBool(loc); break;
+			// ranges take their 'L' in the element spec instead, where each element is localized as its own type
+			case RangeType: errHandle.ReportError(af_errors::ErrorType::invalid_locale_type); break;
 		}
-	// should re-work this a little so using the unsigned buffer isn't totally necessary if not needed, however, WriteBufferToContainer() & WriteToContainer()
-	// use the unsigned buffer at the moment when localization is set , so the contents of the original buffer need to be copied over to the unsigned buffer
-	auto pos { -1 };
-	auto& locBuff { timeSpec.localizationBuff };
-	locBuff.resize(valueSize);
-	for( ;; ) {
-			if( ++pos >= valueSize ) return;
-			locBuff[ pos ] = static_cast<unsigned char>(buffer[ pos ]);
-		}
+	// the localized value is built in place in 'buffer', so clear the flag to have it written out from there instead of the localization buffer
+	specValues.localize = false;
 }
 
 inline void formatter::arg_formatter::ArgFormatter::LocalizeIntegral(const std::locale& loc, const int& precision, const SpecType& type) {
@@ -191,25 +311,15 @@ inline void formatter::arg_formatter::ArgFormatter::LocalizeIntegral(const std::
 
 inline void formatter::arg_formatter::ArgFormatter::LocalizeFloatingPoint(const std::locale& loc, const int& precision, const SpecType& type) {
 	FormatArgument(precision, type);
-	size_t pos { 0 };
-	bool hasMantissa { false };
-	for( ;; ) {
-			if( pos >= valueSize ) break;
-			if( buffer[ pos ] == '.' ) {
-					hasMantissa = true;
-					FormatIntegralGrouping(loc, pos);
-					buffer[ pos ] = std::use_facet<std::numpunct<char>>(loc).decimal_point();
-					++pos;
-					break;
-			}
-			++pos;
-		}
-	if( !hasMantissa ) {
+	auto end { static_cast<size_t>(std::find(buffer.data(), buffer.data() + valueSize, '.') - buffer.data()) };
+	if( end == valueSize ) {
 			FormatIntegralGrouping(loc, valueSize);
-	}
+	} else {
+			buffer[ FormatIntegralGrouping(loc, end) ] = std::use_facet<std::numpunct<char>>(loc).decimal_point();
+		}
 }
 
-inline void formatter::arg_formatter::ArgFormatter::LocalizeCTime(const std::locale& loc, const std::tm& timeStruct, const int& precision) {
+inline void formatter::arg_formatter::ArgFormatter::LocalizeCTime(const locale_type& loc, const std::tm& timeStruct, const int& precision) {
 	using namespace utf_utils;
 
 	auto end { timeSpec.timeSpecCounter };
@@ -221,31 +331,60 @@ inline void formatter::arg_formatter::ArgFormatter::LocalizeCTime(const std::loc
 	// Due to major shifts over to little endian back in the early 2000's, this is making the assumption that the system is LE and NOT BE.
 	AF_ASSERT(utf_utils::IsLittleEndian(), "Big Endian Format Is Currently Unsupported. If Support Is Necessary, Please Open A New Issue At "
 	                                       "'https://github.com/USAFrenzy/ArgFormatter/issues'");
-	static std::basic_ostringstream<u_wchar> localeStream;
-	auto pos { -1 };
-	auto format { timeSpec.timeSpecFormat };
+	// every entry is at most "%E" plus the conversion, leaving room for the terminator std::put_time() needs
+	std::array<u_wchar, 25 * 3 + 1> localeFmt {};
+	size_t fmtSize { 0 };
+	auto& format { timeSpec.timeSpecFormat };
 	auto& cont { timeSpec.timeSpecContainer };
-	u_wstring localeFmt;
-	localeFmt.reserve(cont.size() * 2);
-	for( ;; ) {
-			if( ++pos >= end ) break;
-			if( cont[ pos ] != ' ' ) {
-					localeFmt += '%';
-					format[ pos ] == LocaleFormat::standard ? localeFmt.append(1, cont[ pos ]) : localeFmt.append(LocalizedFormat(cont[ pos ]));
+	for( int pos { 0 }; pos < end; ++pos ) {
+			// literals are stored alongside the conversions, so only letters and an escaped '%' are conversions
+			if( format[ pos ] == LocaleFormat::localized ) {
+					localeFmt[ fmtSize++ ] = '%';
+					fmtSize += LocalizedFormat(cont[ pos ], localeFmt.data() + fmtSize);
+			} else if( IsAlpha(static_cast<char>(cont[ pos ])) || cont[ pos ] == '%' ) {
+					localeFmt[ fmtSize++ ] = '%';
+					localeFmt[ fmtSize++ ] = cont[ pos ];
 			} else {
-					localeFmt.append(1, ' ');
+					localeFmt[ fmtSize++ ] = cont[ pos ];
 				}
 		}
-	localeStream.str(u_wstring {});
-	localeStream.clear();
+	// the stream only lives for this call, so this is safe to call from multiple threads (each with their own formatter) and, once the scratch storage
+	// has grown large enough, doesn't allocate
+	scratch_streambuf<u_wchar> scratch { timeSpec.localizationScratch };
+	std::basic_ostream<u_wchar> localeStream { &scratch };
 	localeStream.imbue(loc);
 	localeStream << std::put_time<u_wchar>(&timeStruct, localeFmt.data());
-	if constexpr( sizeof(u_wchar) == 2 ) {
-			U16ToU8(std::move(localeStream.str()), timeSpec.localizationBuff, valueSize);
-	} else {
-			U32ToU8(std::move(localeStream.str()), timeSpec.localizationBuff, valueSize);
+
+	auto localized { scratch.view() };
+	auto& locBuff { timeSpec.localizationBuff };
+	locBuff.resize(localized.size() * 4);
+	auto dest { reinterpret_cast<char*>(locBuff.data()) };
+	valueSize = 0;
+	for( size_t pos { 0 }; pos < localized.size(); ++pos ) {
+			auto codePoint { static_cast<char32_t>(localized[ pos ]) };
+			if constexpr( sizeof(u_wchar) == 2 ) {
+					if( codePoint >= 0xD800 && codePoint <= 0xDBFF && pos + 1 < localized.size() ) {
+							if( auto low { static_cast<char32_t>(localized[ pos + 1 ]) }; low >= 0xDC00 && low <= 0xDFFF ) {
+									codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+									++pos;
+							}
+					}
+			}
+			valueSize += formatter::unicode::EncodeUtf8(codePoint, dest + valueSize);
 		}
 }
+#else
+// Without locale support the 'L' flag formats like the classic locale does, which is exactly the standard formatting
+inline void formatter::arg_formatter::ArgFormatter::LocalizeArgument(const locale_type&, const int& precision, const SpecType& type) {
+	FormatArgument(precision, type);
+	specValues.localize = false;
+}
+
+inline void formatter::arg_formatter::ArgFormatter::LocalizeCTime(const locale_type&, const std::tm& timeStruct, const int& precision) {
+	specValues.localize = false;
+	FormatCTime(timeStruct, precision, 0, timeSpec.timeSpecCounter);
+}
+#endif
 
 inline void formatter::arg_formatter::ArgFormatter::FormatSubseconds(const int& precision) {
 	std::array<char, 24> buff {};
@@ -334,6 +473,28 @@ inline constexpr void formatter::arg_formatter::BracketSearchResults::Reset() {
 		}
 }
 
+#if !defined(AF_NO_LOCALE)
+template<typename CharT> formatter::arg_formatter::scratch_streambuf<CharT>::scratch_streambuf(std::vector<CharT>& buffer): storage(buffer) {
+	if( storage.size() < 64 ) storage.resize(64);
+	this->setp(storage.data(), storage.data() + storage.size());
+}
+
+template<typename CharT> std::basic_string_view<CharT> formatter::arg_formatter::scratch_streambuf<CharT>::view() const {
+	return std::basic_string_view<CharT>(this->pbase(), static_cast<size_t>(this->pptr() - this->pbase()));
+}
+
+template<typename CharT> auto formatter::arg_formatter::scratch_streambuf<CharT>::overflow(int_type ch) -> int_type {
+	if( traits_type::eq_int_type(ch, traits_type::eof()) ) return traits_type::not_eof(ch);
+	auto used { this->pptr() - this->pbase() };
+	storage.resize(storage.size() * 2);
+	this->setp(storage.data(), storage.data() + storage.size());
+	this->pbump(static_cast<int>(used));
+	*this->pptr() = traits_type::to_char_type(ch);
+	this->pbump(1);
+	return ch;
+}
+#endif
+
 inline constexpr void formatter::arg_formatter::TimeSpecs::Reset() {
 	// the arrays don't need anything special considering values
 	// get overridden by index assignment with the counter
@@ -346,40 +507,37 @@ inline constexpr void formatter::arg_formatter::SpecFormatting::ResetSpecs() {
 			std::memset(this, 0, sizeof(SpecFormatting));
 	} else {
 			argPosition = nestedWidthArgPos = nestedPrecArgPos = 0;
-			localize = hasAlt = hasClosingBrace = false;
+			localize = hasAlt = hasClosingBrace = zeroPad = false;
 			alignmentPadding = precision = 0;
-			fillCharacter = typeSpec = '\0';
+			typeSpec                 = '\0';
+			fillCharacter            = { '\0', '\0', '\0', '\0' };
+			fillSize                 = 0;
 			align                    = Alignment::Empty;
 			signType                 = Sign::Empty;
 			preAltForm               = "";
 		}
 }
 
-inline static constexpr std::vector<char> ConvBuffToSigned(std::vector<unsigned char>& buff, size_t endPos) {
-	std::vector<char> signedTemp(endPos);
-	auto pos { -1 };
-	for( ;; ) {
-			if( ++pos >= endPos ) break;
-			signedTemp[ pos ] = static_cast<signed char>(buff[ pos ]);
-		}
-	return signedTemp;
-}
-
 template<typename T, typename U>
-requires utf_utils::utf_constraints::IsSupportedUSource<T> && utf_utils::utf_constraints::IsSupportedUContainer<U>
+requires utf_utils::utf_constraints::IsSupportedUSource<T> &&
+         (utf_utils::utf_constraints::IsSupportedUContainer<U> || formatter::internal_helper::af_concepts::is_format_sink_v<U>)
 constexpr void formatter::arg_formatter::ArgFormatter::WriteToContainer(T&& buff, size_t endPos, U&& container) {
 	namespace se_con = utf_utils::utf_constraints;
 	using CharType   = typename formatter::internal_helper::af_typedefs::type<U>::value_type;
-	if constexpr( std::is_same_v<CharType, char> ) {
+	if constexpr( formatter::internal_helper::af_concepts::is_format_sink_v<U> ) {
+			// Sinks are byte-oriented, so both the signed and unsigned buffers can be handed over as-is without the signed conversion below
+			container.append(reinterpret_cast<const char*>(buff.data()), endPos);
+	} else if constexpr( std::is_same_v<CharType, char> ) {
 			// Assume utf-8 encoding and just handle as byte strings (as it should have been stored as such internally)
 			if constexpr( std::is_same_v<typename formatter::internal_helper::af_typedefs::type<T>::value_type, unsigned char> && std::is_signed_v<char> ) {
 					// unsigned  char -> char
-					auto tmp { std::move(ConvBuffToSigned(buff, endPos)) };
+					// the bytes are already utf-8, so they're only reinterpreted rather than converted into a signed copy
+					auto tmp { reinterpret_cast<const char*>(buff.data()) };
 					if constexpr( se_con::is_string_v<U> ) {
 							if( endPos == 1 ) {
 									container += tmp[ 0 ];
 							} else {
-									container.append(tmp.data(), endPos);
+									container.append(tmp, endPos);
 								}
 					} else if constexpr( se_con::is_vector_v<U> ) {
 							switch( endPos ) {
@@ -394,10 +552,10 @@ constexpr void formatter::arg_formatter::ArgFormatter::WriteToContainer(T&& buff
 										container.emplace_back(tmp[ 1 ]);
 										container.emplace_back(tmp[ 2 ]);
 										return;
-									default: container.insert(container.end(), tmp.begin(), tmp.begin() + endPos); return;
+									default: container.insert(container.end(), tmp, tmp + endPos); return;
 								}
 					} else {
-							std::copy_n(tmp.begin(), endPos, std::back_inserter(std::forward<U>(container)));
+							std::copy_n(tmp, endPos, std::back_inserter(std::forward<U>(container)));
 							return;
 						}
 			} else {
@@ -431,26 +589,30 @@ constexpr void formatter::arg_formatter::ArgFormatter::WriteToContainer(T&& buff
 	} else if constexpr( se_con::is_u16_type_string_v<U> ) {
 			AF_ASSERT(utf_utils::IsLittleEndian(), "Big Endian Format Is Currently Unsupported. If Support Is Necessary, Please Open A New Issue At "
 			                                       "'https://github.com/USAFrenzy/ArgFormatter/issues'");
-			// Assume utf-16 encoding and convert from utf-8
+			// Assume utf-16 encoding and transcode the first 'endPos' bytes straight into the container's storage
+			auto src { reinterpret_cast<const char*>(buff.data()) };
 			if constexpr( se_con::is_string_v<U> || se_con::is_vector_v<U> ) {
-					utf_utils::U8ToU16(buff, std::forward<U>(container));
+					auto start { container.size() };
+					container.resize(start + endPos);
+					container.resize(start + simd::TranscodeUtf8(src, endPos, container.data() + start));
 			} else {
-					std::u16string tmp;
-					tmp.reserve(endPos);
-					utf_utils::U8ToU16(buff, tmp);
-					std::copy_n(tmp.begin(), endPos, std::back_inserter(std::forward<U>(container)));
+					std::basic_string<CharType> tmp(endPos, CharType {});
+					tmp.resize(simd::TranscodeUtf8(src, endPos, tmp.data()));
+					std::copy(tmp.begin(), tmp.end(), std::back_inserter(std::forward<U>(container)));
 				}
 	} else if constexpr( se_con::is_u32_type_string_v<U> ) {
 			AF_ASSERT(utf_utils::IsLittleEndian(), "Big Endian Format Is Currently Unsupported. If Support Is Necessary, Please Open A New Issue At "
 			                                       "'https://github.com/USAFrenzy/ArgFormatter/issues'");
-			// Assume utf-32 encoding and convert from utf-8
+			// Assume utf-32 encoding and transcode the first 'endPos' bytes straight into the container's storage
+			auto src { reinterpret_cast<const char*>(buff.data()) };
 			if constexpr( se_con::is_string_v<U> || se_con::is_vector_v<U> ) {
-					utf_utils::U8ToU32(buff, std::forward<U>(container));
+					auto start { container.size() };
+					container.resize(start + endPos);
+					container.resize(start + simd::TranscodeUtf8(src, endPos, container.data() + start));
 			} else {
-					std::u32string tmp;
-					tmp.reserve(endPos);
-					utf_utils::U8ToU32(buff, tmp);
-					std::copy_n(tmp.begin(), endPos, std::back_inserter(std::forward<U>(container)));
+					std::basic_string<CharType> tmp(endPos, CharType {});
+					tmp.resize(simd::TranscodeUtf8(src, endPos, tmp.data()));
+					std::copy(tmp.begin(), tmp.end(), std::back_inserter(std::forward<U>(container)));
 				}
 	}
 }
@@ -459,12 +621,7 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Writ
 	if( !specValues.localize ) {
 			WriteToContainer(buffer, valueSize, std::forward<T>(container));
 	} else {
-			auto& localeBuff { timeSpec.localizationBuff };
-			if constexpr( std::is_signed_v<char> ) {
-					WriteToContainer(std::move(ConvBuffToSigned(localeBuff, valueSize)), valueSize, std::forward<T>(container));
-			} else {
-					WriteToContainer(localeBuff, valueSize, std::forward<T>(container));
-				}
+			WriteToContainer(timeSpec.localizationBuff, valueSize, std::forward<T>(container));
 		}
 }
 
@@ -484,6 +641,7 @@ constexpr void formatter::arg_formatter::ArgFormatter::format_to(std::back_inser
 	argCounter                   = lastRootCounter;
 }
 
+#if !defined(AF_NO_LOCALE)
 template<typename T, typename... Args>
 constexpr void formatter::arg_formatter::ArgFormatter::format_to(std::back_insert_iterator<T>&& Iter, const std::locale& loc, std::string_view sv, Args&&... args) {
 	lastRootCounter = argCounter;
@@ -491,6 +649,70 @@ constexpr void formatter::arg_formatter::ArgFormatter::format_to(std::back_inser
 	argStorage.isCustomFormatter = false;
 	argCounter                   = lastRootCounter;
 }
+#endif
+
+template<typename T, typename... Args>
+formatter::af_errors::format_result formatter::arg_formatter::ArgFormatter::try_format_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, Args&&... args) {
+	return TryFormat(std::move(Iter), [ & ](std::back_insert_iterator<T>&& iter) { format_to(std::move(iter), sv, std::forward<Args>(args)...); });
+}
+
+#if !defined(AF_NO_LOCALE)
+template<typename T, typename... Args>
+formatter::af_errors::format_result formatter::arg_formatter::ArgFormatter::try_format_to(std::back_insert_iterator<T>&& Iter, const std::locale& loc,
+                                                                                         std::string_view sv, Args&&... args) {
+	return TryFormat(std::move(Iter), [ & ](std::back_insert_iterator<T>&& iter) { format_to(std::move(iter), loc, sv, std::forward<Args>(args)...); });
+}
+#endif
+
+template<typename T, typename Formatting>
+formatter::af_errors::format_result formatter::arg_formatter::ArgFormatter::TryFormat(std::back_insert_iterator<T>&& Iter, Formatting&& formatting) {
+	using Container = formatter::internal_helper::af_typedefs::type<T>;
+	constexpr bool isSized { requires(Container& cont) { cont.size(); } };
+	constexpr bool isResizable { requires(Container& cont) { cont.resize(cont.size()); } };
+	auto& container { internal_helper::IteratorAccessHelper(Iter).Container() };
+	size_t startSize { 0 };
+	if constexpr( isSized ) startSize = container.size();
+	auto written { [ & ]() -> size_t {
+		if constexpr( isSized ) {
+				return container.size() - startSize;
+		} else {
+				return 0;
+			}
+	} };
+	// a custom formatter may call try_format_to() from inside another one, so the outer call's setting is put back afterwards
+	auto wasCollecting { errHandle.collecting };
+	errHandle.collecting = true;
+	formatting(std::move(Iter));
+	errHandle.collecting = wasCollecting;
+	if( errHandle.failed ) {
+			errHandle.failed = false;
+			// put the formatter back the way format_to() leaves it so the next call starts clean
+			argStorage.isCustomFormatter = false;
+			argCounter                   = lastRootCounter;
+			if constexpr( isResizable ) container.resize(startSize);
+			return af_errors::format_result(errHandle.error, written());
+	}
+	return af_errors::format_result(written());
+}
+
+template<typename T>
+void formatter::arg_formatter::ArgFormatter::format_record_to(std::back_insert_iterator<T>&& Iter, const msg_details::ArgRecordView& record) {
+	lastRootCounter = argCounter;
+	argStorage.ResetCapture();
+	if( !record.ForEachArg([ this ](auto&& value, msg_details::SpecType type) { argStorage.StoreRecordArg(std::forward<decltype(value)>(value), type); }) ) {
+			errHandle.ReportError(af_errors::ErrorType::binary_log_corrupt);
+	}
+	ParseFormatString(std::move(Iter), record.FormatString());
+	argStorage.isCustomFormatter = false;
+	argCounter                   = lastRootCounter;
+}
+
+inline std::string formatter::arg_formatter::ArgFormatter::format_record(const msg_details::ArgRecordView& record) {
+	std::string tmp;
+	tmp.reserve(record.size());
+	format_record_to(std::back_inserter(tmp), record);
+	return tmp;
+}
 
 template<typename... Args> std::string formatter::arg_formatter::ArgFormatter::format(std::string_view sv, Args&&... args) {
 	std::string tmp;
@@ -499,103 +721,211 @@ template<typename... Args> std::string formatter::arg_formatter::ArgFormatter::f
 	return tmp;
 }
 
+#if !defined(AF_NO_LOCALE)
 template<typename... Args> std::string formatter::arg_formatter::ArgFormatter::format(const std::locale& loc, std::string_view sv, Args&&... args) {
 	std::string tmp;
 	tmp.reserve(ReserveCapacity(std::forward<Args>(args)...));
 	format_to(std::move(std::back_inserter(tmp)), loc, sv, std::forward<Args>(args)...);
 	return tmp;
 }
+#endif
 
-template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteAlignedLeft(T&& container, const int& totalWidth) {
-	if( totalWidth > fillBuffDefaultCapacity ) fillBuffer.reserve(totalWidth);
-	FillBuffWithChar(totalWidth);
-	std::memcpy(fillBuffer.data(), buffer.data(), valueSize);
-	WriteToContainer(fillBuffer, totalWidth, std::forward<T>(container));
-}
-
+// The padding and the value are written directly into the destination. Char strings and vectors are grown once up front (with the same geometric growth
+// appending would have used) so that none of the three writes reallocate, and their padding is filled in place; every other container takes its padding
+// from the fill buffer, a block at a time for fields wider than it.
 template<typename T>
-constexpr void formatter::arg_formatter::ArgFormatter::WriteAlignedLeft(T&& container, std::string_view val, const int& precision, const int& totalWidth) {
-	if( totalWidth > fillBuffDefaultCapacity ) fillBuffer.reserve(totalWidth);
-	FillBuffWithChar(totalWidth);
-	std::memcpy(fillBuffer.data(), val.data(), precision);
-	WriteToContainer(fillBuffer, totalWidth, std::forward<T>(container));
-}
-
-template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteAlignedRight(T&& container, const int& totalWidth, const size_t& fillAmount) {
-	if( totalWidth > fillBuffDefaultCapacity ) fillBuffer.reserve(totalWidth);
-	FillBuffWithChar(totalWidth);
-	std::memcpy(fillBuffer.data() + fillAmount, buffer.data(), valueSize);
-	WriteToContainer(fillBuffer, totalWidth, std::forward<T>(container));
+constexpr void formatter::arg_formatter::ArgFormatter::WriteAligned(T&& container, std::string_view val, const size_t& before, const size_t& after) {
+	namespace se_con = utf_utils::utf_constraints;
+	if( specValues.fillSize == 0 ) SetFillCharacter(" ");
+	if constexpr( !formatter::internal_helper::af_concepts::is_format_sink_v<T> ) {
+			using CharType = typename formatter::internal_helper::af_typedefs::type<T>::value_type;
+			if constexpr( std::is_same_v<CharType, char> && (se_con::is_string_v<T> || se_con::is_vector_v<T>) ) {
+					if( auto needed { container.size() + (before + after) * specValues.fillSize + val.size() }; needed > container.capacity() ) {
+							container.reserve(std::max(needed, container.capacity() * 2));
+					}
+			}
+	}
+	WriteSimplePadding(container, before);
+	WriteToContainer(val, val.size(), container);
+	WriteSimplePadding(container, after);
 }
 
-template<typename T>
-constexpr void formatter::arg_formatter::ArgFormatter::WriteAlignedRight(T&& container, std::string_view val, const int& precision, const int& totalWidth,
-                                                                         const size_t& fillAmount) {
-	if( totalWidth > fillBuffDefaultCapacity ) fillBuffer.reserve(totalWidth);
-	FillBuffWithChar(totalWidth);
-	std::memcpy(fillBuffer.data() + fillAmount, val.data(), precision);
-	WriteToContainer(fillBuffer, totalWidth, std::forward<T>(container));
+template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteNonAligned(T&& container) {
+	WriteToContainer(buffer, valueSize, std::forward<T>(container));
 }
 
-template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteAlignedCenter(T&& container, const int& totalWidth, const size_t& fillAmount) {
-	if( totalWidth > fillBuffDefaultCapacity ) fillBuffer.reserve(totalWidth);
-	FillBuffWithChar(totalWidth);
-	std::memcpy(fillBuffer.data() + fillAmount, buffer.data(), valueSize);
-	WriteToContainer(fillBuffer, totalWidth, std::forward<T>(container));
+template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteNonAligned(T&& container, std::string_view val, const int& precision) {
+	WriteToContainer(val, precision, std::forward<T>(container));
 }
 
-template<typename T>
-constexpr void formatter::arg_formatter::ArgFormatter::WriteAlignedCenter(T&& container, std::string_view val, const int& precision, const int& totalWidth,
-                                                                          const size_t& fillAmount) {
-	if( totalWidth > fillBuffDefaultCapacity ) fillBuffer.reserve(totalWidth);
-	FillBuffWithChar(totalWidth);
-	std::memcpy(fillBuffer.data() + fillAmount, val.data(), precision);
-	WriteToContainer(fillBuffer, totalWidth, std::forward<T>(container));
+inline constexpr void formatter::arg_formatter::ArgFormatter::FillPattern(char* dest, size_t count) {
+	size_t fillSize { specValues.fillSize };
+	auto total { count * fillSize };
+	if( total == 0 ) return;
+	std::copy_n(specValues.fillCharacter.data(), fillSize, dest);
+	for( auto filled { fillSize }; filled < total; ) {
+			auto chunk { std::min(filled, total - filled) };
+			std::copy_n(dest, chunk, dest + filled);
+			filled += chunk;
+		}
 }
 
-template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteNonAligned(T&& container) {
-	WriteToContainer(buffer, valueSize, std::forward<T>(container));
+template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteSimplePadding(T&& container, const size_t& fillAmount) {
+	namespace se_con = utf_utils::utf_constraints;
+	if( fillAmount == 0 ) return;
+	if( specValues.fillSize == 0 ) SetFillCharacter(" ");
+	size_t fillSize { specValues.fillSize };
+	if constexpr( !formatter::internal_helper::af_concepts::is_format_sink_v<T> ) {
+			using CharType = typename formatter::internal_helper::af_typedefs::type<T>::value_type;
+			if constexpr( std::is_same_v<CharType, char> && (se_con::is_string_v<T> || se_con::is_vector_v<T>) ) {
+					if( fillSize == 1 ) {
+							container.insert(container.end(), fillAmount, specValues.fillCharacter[ 0 ]);
+					} else {
+							auto start { container.size() };
+							container.resize(start + fillAmount * fillSize);
+							FillPattern(container.data() + start, fillAmount);
+						}
+					return;
+			}
+	}
+	// the fill buffer holds a whole number of fill characters so that a block never ends partway through one
+	auto blockCount { std::min(fillAmount, static_cast<size_t>(fillBuffDefaultCapacity) / fillSize) };
+	fillBuffer.resize(blockCount * fillSize);
+	FillPattern(fillBuffer.data(), blockCount);
+	for( auto remaining { fillAmount }; remaining != 0; ) {
+			auto count { std::min(remaining, blockCount) };
+			WriteToContainer(fillBuffer, count * fillSize, container);
+			remaining -= count;
+		}
 }
 
-template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteNonAligned(T&& container, std::string_view val, const int& precision) {
-	WriteToContainer(val, precision, std::forward<T>(container));
+inline size_t formatter::arg_formatter::ArgFormatter::ZeroPadPrefixSize(const SpecType& argType) {
+	using enum msg_details::SpecType;
+	// only the first 'valueSize' bytes of 'buffer' belong to this value, anything past them is left over from an earlier one
+	size_t prefixSize { valueSize != 0 && (buffer[ 0 ] == '+' || buffer[ 0 ] == '-' || buffer[ 0 ] == ' ') ? size_t { 1 } : size_t { 0 } };
+	prefixSize += (argType == ConstVoidPtrType || argType == VoidPtrType) ? size_t { 2 } : specValues.preAltForm.size();
+	return std::min(prefixSize, valueSize);
 }
 
-template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteSimplePadding(T&& container, const size_t& fillAmount) {
-	WriteToContainer(buffer, fillAmount, std::forward<T>(container));
+template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteZeroPadded(T&& container, const int& totalWidth, size_t prefixSize) {
+	auto fill { static_cast<size_t>(std::max(totalWidth, 0)) > valueSize ? static_cast<size_t>(totalWidth) - valueSize : size_t { 0 } };
+	if( fill == 0 ) return WriteNonAligned(std::forward<T>(container));
+	// infinities and NaNs are padded as though there was no '0' flag
+	if( prefixSize < valueSize && (buffer[ prefixSize ] == 'i' || buffer[ prefixSize ] == 'n') ) return FormatAlignment(std::forward<T>(container), totalWidth);
+	if( prefixSize != 0 ) WriteToContainer(buffer, prefixSize, container);
+	SetFillCharacter("0");
+	WriteAligned(std::forward<T>(container), std::string_view(buffer.data() + prefixSize, valueSize - prefixSize), fill, 0);
 }
 
-inline constexpr void formatter::arg_formatter::ArgFormatter::FillBuffWithChar(const int& totalWidth) {
-	!std::is_constant_evaluated() ? static_cast<void>(std::memset(fillBuffer.data(), specValues.fillCharacter, totalWidth))
-								  : fillBuffer.resize(totalWidth, specValues.fillCharacter);
+template<typename T, typename V>
+requires std::is_integral_v<std::remove_cvref_t<V>>
+constexpr void formatter::arg_formatter::ArgFormatter::WriteZeroPaddedInteger(T&& container, V&& value, const int& totalWidth) {
+	namespace se_con = utf_utils::utf_constraints;
+	using Unsigned = std::make_unsigned_t<std::remove_cvref_t<V>>;
+	int base { 10 };
+	bool isUpper { false };
+	SetIntegralFormat(base, isUpper);
+	auto isNegative { false };
+	if constexpr( std::is_signed_v<std::remove_cvref_t<V>> ) isNegative = value < 0;
+	// the magnitude is written rather than the value so that the sign always comes first, ahead of any base prefix
+	auto magnitude { isNegative ? static_cast<Unsigned>(Unsigned { 0 } - static_cast<Unsigned>(value)) : static_cast<Unsigned>(value) };
+	auto sign { isNegative ? '-' : specValues.signType == Sign::Plus ? '+' : specValues.signType == Sign::Space ? ' ' : '\0' };
+	auto prefix { specValues.preAltForm };
+	auto digits { CountDigits(magnitude, base) };
+	auto prefixSize { (sign != '\0' ? size_t { 1 } : size_t { 0 }) + prefix.size() };
+	auto used { prefixSize + digits };
+	auto size { std::max(static_cast<size_t>(totalWidth), used) };
+	auto writeValue { [ & ](char* dest, size_t zeros) {
+		if( sign != '\0' ) *dest++ = sign;
+		dest = std::copy(prefix.begin(), prefix.end(), dest);
+		dest = std::fill_n(dest, zeros, '0');
+		WriteDigits(magnitude, base, digits, dest, isUpper);
+	} };
+	if constexpr( !formatter::internal_helper::af_concepts::is_format_sink_v<T> ) {
+			using CharType = typename formatter::internal_helper::af_typedefs::type<T>::value_type;
+			if constexpr( std::is_same_v<CharType, char> && (se_con::is_string_v<T> || se_con::is_vector_v<T>) ) {
+					auto start { container.size() };
+					container.resize(start + size);
+					return writeValue(container.data() + start, size - used);
+			}
+	}
+	writeValue(buffer.data(), 0);
+	valueSize = used;
+	WriteZeroPadded(std::forward<T>(container), totalWidth, prefixSize);
 }
 
 template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::FormatAlignment(T&& container, const int& totalWidth) {
 	if( auto fill { (totalWidth > valueSize) ? totalWidth - valueSize : 0 }; fill != 0 ) {
+			// only a localized time is left in the localization buffer, everything else is formatted into 'buffer'
+			std::string_view value { specValues.localize ? std::string_view(reinterpret_cast<const char*>(timeSpec.localizationBuff.data()), valueSize)
+				                                         : std::string_view(buffer.data(), valueSize) };
 			switch( specValues.align ) {
-					case Alignment::AlignLeft: return WriteAlignedLeft(std::forward<T>(container), totalWidth);
-					case Alignment::AlignRight: return WriteAlignedRight(std::forward<T>(container), totalWidth, fill);
-					case Alignment::AlignCenter: return WriteAlignedCenter(std::forward<T>(container), totalWidth, fill / 2);
+					case Alignment::AlignLeft: return WriteAligned(std::forward<T>(container), value, 0, fill);
+					case Alignment::AlignRight: return WriteAligned(std::forward<T>(container), value, fill, 0);
+					case Alignment::AlignCenter: return WriteAligned(std::forward<T>(container), value, fill / 2, fill - fill / 2);
+					// a field without an argument ("{:*5}") is nothing but its padding
 					default: return WriteSimplePadding(std::forward<T>(container), fill);
 				}
 	} else {
-			WriteNonAligned(std::forward<T>(container));
+			WriteBufferToContainer(std::forward<T>(container));
+		}
+}
+
+inline constexpr bool formatter::arg_formatter::ArgFormatter::IsZeroPaddable(const SpecType& argType) {
+	using enum msg_details::SpecType;
+	switch( argType ) {
+			case IntType: [[fallthrough]];
+			case U_IntType: [[fallthrough]];
+			case LongLongType: [[fallthrough]];
+			case U_LongLongType: return specValues.typeSpec != 'c';
+			case FloatType: [[fallthrough]];
+			case DoubleType: [[fallthrough]];
+			case LongDoubleType: [[fallthrough]];
+			case ConstVoidPtrType: [[fallthrough]];
+			case VoidPtrType: return true;
+			// bools and chars are only numbers when they're presented as one
+			case BoolType: [[fallthrough]];
+			case CharType: return specValues.typeSpec != '\0' && specValues.typeSpec != 's' && specValues.typeSpec != 'c' && specValues.typeSpec != '?';
+			default: return false;
 		}
 }
 
+template<typename T>
+constexpr void formatter::arg_formatter::ArgFormatter::FormatZeroPadded(T&& container, const locale_type& loc, const SpecType& argType, const int& totalWidth,
+                                                                        const int& precision) {
+	using enum msg_details::SpecType;
+	if( !IsZeroPaddable(argType) ) {
+			!specValues.localize ? FormatArgument(precision, argType) : LocalizeArgument(loc, precision, argType);
+			return FormatAlignment(std::forward<T>(container), totalWidth);
+	}
+	if( !specValues.localize ) {
+			auto& storage { argStorage.isCustomFormatter ? customStorage : argStorage };
+			switch( argType ) {
+					case IntType: return WriteZeroPaddedInteger(std::forward<T>(container), storage.int_state(specValues.argPosition), totalWidth);
+					case U_IntType: return WriteZeroPaddedInteger(std::forward<T>(container), storage.uint_state(specValues.argPosition), totalWidth);
+					case LongLongType: return WriteZeroPaddedInteger(std::forward<T>(container), storage.long_long_state(specValues.argPosition), totalWidth);
+					case U_LongLongType: return WriteZeroPaddedInteger(std::forward<T>(container), storage.u_long_long_state(specValues.argPosition), totalWidth);
+					default: break;
+				}
+	}
+	!specValues.localize ? FormatArgument(precision, argType) : LocalizeArgument(loc, precision, argType);
+	WriteZeroPadded(std::forward<T>(container), totalWidth, ZeroPadPrefixSize(argType));
+}
+
 template<typename T>
 constexpr void formatter::arg_formatter::ArgFormatter::FormatAlignment(T&& container, std::string_view val, const int& totalWidth, int precision) {
-	auto size { static_cast<int>(val.size()) };
-	precision = precision != 0 ? precision > size ? size : precision : size;
-	if( auto fill { totalWidth > size ? totalWidth - size : 0 }; fill != 0 ) {
+	// the width and precision are both counted in display columns while the writes below work in bytes
+	auto [ bytes, columns ] { MeasureDisplayWidth(val, precision) };
+	auto size { static_cast<int>(bytes) };
+	if( auto fill { totalWidth > static_cast<int>(columns) ? totalWidth - static_cast<int>(columns) : 0 }; fill != 0 ) {
 			switch( specValues.align ) {
-					case Alignment::AlignLeft: return WriteAlignedLeft(std::forward<T>(container), val, precision, totalWidth);
-					case Alignment::AlignRight: return WriteAlignedRight(std::forward<T>(container), val, precision, totalWidth, fill);
-					case Alignment::AlignCenter: return WriteAlignedCenter(std::forward<T>(container), val, precision, totalWidth, fill / 2);
+					case Alignment::AlignLeft: return WriteAligned(std::forward<T>(container), val.substr(0, bytes), 0, fill);
+					case Alignment::AlignRight: return WriteAligned(std::forward<T>(container), val.substr(0, bytes), fill, 0);
+					case Alignment::AlignCenter: return WriteAligned(std::forward<T>(container), val.substr(0, bytes), fill / 2, fill - fill / 2);
 					default: return WriteSimplePadding(std::forward<T>(container), fill);
 				}
 	} else {
-			WriteNonAligned(std::forward<T>(container), val, precision);
+			WriteNonAligned(std::forward<T>(container), val, size);
 		}
 }
 
@@ -622,8 +952,12 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Form
 				}
 	}
 	// Handles The Case Of Specifiers WITH Alignment
+	if( (specValues.typeSpec == 'j' || specValues.typeSpec == '?') && argType != SpecType::CharType ) {
+			return FormatEscapedAlignment(std::forward<T>(container), argType, totalWidth, precision);
+	}
 	switch( argType ) {
 			default:
+				if( specValues.zeroPad ) return FormatZeroPadded(std::forward<T>(container), default_locale, argType, totalWidth, precision);
 				!specValues.localize ? FormatArgument(precision, argType) : LocalizeArgument(default_locale, precision, argType);
 				FormatAlignment(std::forward<T>(container), totalWidth);
 				return;
@@ -637,7 +971,7 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Form
 		}
 }
 
-template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Format(T&& container, const std::locale& loc, const msg_details::SpecType& argType) {
+template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Format(T&& container, const locale_type& loc, const msg_details::SpecType& argType) {
 	auto& storage { argStorage.isCustomFormatter ? customStorage : argStorage };
 	auto precision { specValues.nestedPrecArgPos != 0 ? storage.int_state(specValues.nestedPrecArgPos) : specValues.precision != 0 ? specValues.precision : 0 };
 	auto totalWidth { specValues.nestedWidthArgPos != 0  ? storage.int_state(specValues.nestedWidthArgPos)
@@ -660,8 +994,12 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Form
 				}
 	}
 	// Handles The Case Of Specifiers WITH Alignment
+	if( (specValues.typeSpec == 'j' || specValues.typeSpec == '?') && argType != SpecType::CharType ) {
+			return FormatEscapedAlignment(std::forward<T>(container), argType, totalWidth, precision);
+	}
 	switch( argType ) {
 			default:
+				if( specValues.zeroPad ) return FormatZeroPadded(std::forward<T>(container), loc, argType, totalWidth, precision);
 				!specValues.localize ? FormatArgument(precision, argType) : LocalizeArgument(loc, precision, argType);
 				FormatAlignment(std::forward<T>(container), totalWidth);
 				return;
@@ -695,7 +1033,7 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyTimeSpec(std
 									timeSpec.timeSpecContainer[ counter ] = sv[ pos ];
 									++counter;
 									break;
-								default: errHandle.ReportError(af_errors::ErrorType::invalid_ctime_spec);
+								default: return errHandle.ReportParseError(af_errors::ErrorType::invalid_ctime_spec);
 							}
 						break;
 					case 'O':
@@ -717,7 +1055,7 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyTimeSpec(std
 									timeSpec.timeSpecContainer[ counter ] = sv[ pos ];
 									++counter;
 									break;
-								default: errHandle.ReportError(af_errors::ErrorType::invalid_ctime_spec);
+								default: return errHandle.ReportParseError(af_errors::ErrorType::invalid_ctime_spec);
 							}
 						break;
 					case 'T':
@@ -788,7 +1126,9 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyTimeSpec(std
 					return;
 			}
 			switch( sv[ pos ] ) {
-					case '%': ++pos >= size ? errHandle.ReportError(af_errors::ErrorType::missing_ctime_spec) : void(0); continue;
+					case '%':
+						if( ++pos >= size ) return errHandle.ReportParseError(af_errors::ErrorType::missing_ctime_spec);
+						continue;
 					case '}':
 						{
 							counterRef = counter;
@@ -800,15 +1140,20 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyTimeSpec(std
 }
 
 inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyFillAlignTimeField(std::string_view sv, size_t& currentPos) {
-	const auto& ch { sv[ currentPos ] };
+	auto fill { FillSequence(sv, currentPos) };
+	currentPos += fill.size() - 1;
 	switch( ++currentPos >= sv.size() ? '}' : sv[ currentPos ] ) {
-			case '<': OnAlignLeft(ch, currentPos); return;
-			case '>': OnAlignRight(ch, currentPos); return;
-			case '^': OnAlignCenter(ch, currentPos); return;
+			case '<': OnAlignLeft(fill, currentPos); return;
+			case '>': OnAlignRight(fill, currentPos); return;
+			case '^': OnAlignCenter(fill, currentPos); return;
 			default:
-				--currentPos;
-				specValues.fillCharacter = ' ';
-				break;
+				currentPos -= fill.size();
+				switch( sv[ currentPos ] ) {
+						case '<': OnAlignLeft(" ", currentPos); return;
+						case '>': OnAlignRight(" ", currentPos); return;
+						case '^': OnAlignCenter(" ", currentPos); return;
+						default: SetFillCharacter(" "); return;
+					}
 		}
 }
 
@@ -817,13 +1162,12 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyTimePrecisio
 	if( const auto& ch { sv[ ++currentPosition ] }; IsDigit(ch) ) {
 			auto data { sv.data() };
 			currentPosition += se_from_chars(data + currentPosition, specValues.precision);
-			++argCounter;
 			return;
 	} else {
 			switch( ch ) {
 					case '{': VerifyPositionalField(sv, ++currentPosition, specValues.nestedPrecArgPos); return;
 					case '}': VerifyPositionalField(sv, currentPosition, specValues.nestedPrecArgPos); return;
-					default: errHandle.ReportError(af_errors::ErrorType::missing_bracket); return;
+					default: return errHandle.ReportParseError(af_errors::ErrorType::missing_bracket);
 				}
 		}
 }
@@ -833,15 +1177,15 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::ParseTimeField(std
 	auto svSize { sv.size() };
 	if( sv[ start ] != '%' ) {
 			VerifyFillAlignTimeField(sv, start);
-			if( start >= svSize ) return;
+			if( start >= svSize || errHandle.failed ) return;
 	}
 	if( (sv[ start ] == '{') || (sv[ start ] >= '1' && sv[ start ] <= '9') ) {
 			VerifyWidthField(sv, start);
-			if( start >= svSize ) return;
+			if( start >= svSize || errHandle.failed ) return;
 	}
 	if( sv[ start ] == '.' ) {
 			VerifyTimePrecisionField(sv, start);
-			if( start >= svSize ) return;
+			if( start >= svSize || errHandle.failed ) return;
 	}
 	if( sv[ start ] == 'L' ) {
 			specValues.localize = true;
@@ -858,7 +1202,7 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Form
 		              : specValues.alignmentPadding != 0 ? specValues.alignmentPadding
 		                                                 : 0 };
 	const auto& counter { timeSpec.timeSpecCounter };
-	if( totalWidth == 0 && precision == 0 && counter < 2 ) {
+	if( totalWidth == 0 && precision == 0 && counter < 2 && !specValues.localize ) {
 			return WriteSimpleCTime(std::forward<T>(container));
 	} else if( totalWidth == 0 ) {
 			!specValues.localize ? FormatCTime(storage.c_time_state(specValues.argPosition), precision, 0, counter)
@@ -871,7 +1215,7 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Form
 		}
 }
 
-template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::FormatTimeField(T&& container, const std::locale& loc) {
+template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::FormatTimeField(T&& container, const locale_type& loc) {
 	auto& storage { argStorage.isCustomFormatter ? customStorage : argStorage };
 	auto precision { specValues.nestedPrecArgPos != 0 ? storage.int_state(specValues.nestedPrecArgPos) : specValues.precision != 0 ? specValues.precision : 0 };
 	auto totalWidth { specValues.nestedWidthArgPos != 0  ? storage.int_state(specValues.nestedWidthArgPos)
@@ -879,7 +1223,7 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Form
 		                                                 : 0 };
 	;
 	const auto& counter { timeSpec.timeSpecCounter };
-	if( totalWidth == 0 && precision == 0 && counter < 2 ) {
+	if( totalWidth == 0 && precision == 0 && counter < 2 && !specValues.localize ) {
 			return WriteSimpleCTime(std::forward<T>(container));
 	} else if( totalWidth == 0 ) {
 			!specValues.localize ? FormatCTime(storage.c_time_state(specValues.argPosition), precision, counter)
@@ -895,7 +1239,7 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Form
 inline constexpr void formatter::arg_formatter::ArgFormatter::Parse(std::string_view sv, size_t& start, const msg_details::SpecType& argType) {
 	auto svSize { sv.size() };
 	VerifyFillAlignField(sv, start, argType);
-	if( start >= svSize ) return;
+	if( start >= svSize || errHandle.failed ) return;
 	switch( sv[ start ] ) {
 			case '+':
 				specValues.signType = Sign::Plus;
@@ -913,25 +1257,24 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::Parse(std::string_
 		}
 	if( sv[ start ] == '#' ) {
 			VerifyAltField(argType);
-			if( ++start >= svSize ) return;
+			if( ++start >= svSize || errHandle.failed ) return;
 	}
 	if( sv[ start ] == '0' ) {
-			if( specValues.fillCharacter == '\0' ) {
-					specValues.fillCharacter = '0';
-			}
+			// as with std::format, the '0' flag is ignored when an alignment was given explicitly
+			if( specValues.fillSize == 0 ) specValues.zeroPad = true;
 			if( ++start >= svSize ) return;
 	}
 	if( (sv[ start ] == '{') || (sv[ start ] >= '1' && sv[ start ] <= '9') ) {
 			VerifyWidthField(sv, start);
-			if( start >= svSize ) return;
+			if( start >= svSize || errHandle.failed ) return;
 	}
 	if( sv[ start ] == '.' ) {
 			VerifyPrecisionField(sv, start, argType);
-			if( start >= svSize ) return;
+			if( start >= svSize || errHandle.failed ) return;
 	}
 	if( sv[ start ] == 'L' ) {
 			VerifyLocaleField(start, argType);
-			if( start >= svSize ) return;
+			if( start >= svSize || errHandle.failed ) return;
 	}
 	if( sv[ start ] != '}' ) {
 			HandlePotentialTypeField(sv[ start ], argType);
@@ -951,11 +1294,13 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Pars
 	auto& container { internal_helper::IteratorAccessHelper(std::move(Iter)).Container() };
 	for( ;; ) {
 			specValues.ResetSpecs();
+			// the time formatting paths append to the buffer rather than overwrite it, so anything left over from the last field has to go
+			valueSize = 0;
 			const auto& storage { argStorage.isCustomFormatter ? customStorage : argStorage };
 			// Check small sv size conditions and handle the niche cases, otherwise break and continue onward
 			switch( sv.size() ) {
 					case 0: return;
-					case 1: WriteToContainer(sv, 1, container); return;
+					case 1: WriteReferenceToContainer(sv, 1, container); return;
 					case 2:
 						// Handle If format string only contains '{}' and no other text
 						if( sv[ 0 ] == '{' && sv[ 1 ] == '}' ) {
@@ -972,20 +1317,21 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Pars
 						}
 						// Otherwise, write out any remaining characters as-is and bypass the check that would have found
 						// this case in FindBrackets(). In most cases, ending early here saw ~2-3% gain in performance
-						WriteToContainer(sv, 2, container);
+						WriteReferenceToContainer(sv, 2, container);
 						return;
 					default: break;
 				}
 			// If the above wasn't executed, then find the first pair of curly brackets and if none were found, write out the parse string as-is
 			if( !FindBrackets(sv) ) {
-					WriteToContainer(sv, sv.size(), container);
+					if( errHandle.failed ) return;
+					WriteReferenceToContainer(sv, sv.size(), container);
 					return;
 			}
 			// If the position of the first curly bracket found isn't the beginning of the parse string, then write the text as-is up until the bracket position
 			auto& begin { bracketResults.beginPos };
 			auto& end { bracketResults.endPos };
 			if( begin > 0 ) {
-					WriteToContainer(sv, begin, container);
+					WriteReferenceToContainer(sv, begin, container);
 					sv.remove_prefix(begin);
 					end -= begin;
 					begin = 0;
@@ -1002,7 +1348,10 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Pars
 			//                argBracket[ bracketSize - 2 ] is used here to check if the position before the close bracket is another closing bracket instead.
 			if( bracketSize > 3 && argBracket[ bracketSize - 2 ] == '}' ) specValues.hasClosingBrace = true;
 			/************************************* Handle Positional Args *************************************/
-			if( !VerifyPositionalField(argBracket, pos, specValues.argPosition) ) {
+			auto hasSpecs { VerifyPositionalField(argBracket, pos, specValues.argPosition) };
+			// with try_format_to() the parsing functions record an error and return instead of reporting it, so nothing past a failed step can run
+			if( errHandle.failed ) return;
+			if( !hasSpecs ) {
 					// Nothing Else to Parse- just a simple substitution after position field so write it and continue parsing format string
 					switch( const auto& argType { storage.SpecTypesCaptured()[ specValues.argPosition ] } ) {
 							case SpecType::CustomType:
@@ -1032,13 +1381,18 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Pars
 						}
 					case SpecType::CTimeType:
 						ParseTimeField(argBracket, pos);
+						if( errHandle.failed ) return;
 						FormatTimeField(container);
 						break;
+					case SpecType::RangeType: FormatRange(container, argBracket.substr(pos)); break;
 					default:
 						Parse(argBracket, pos, argType);
+						if( errHandle.failed ) return;
 						Format(container, argType);
 						break;
 				}
+			// a custom formatter's nested calls and a range's element spec can fail too
+			if( errHandle.failed ) return;
 			if( specValues.hasClosingBrace ) {
 					WriteToContainer(closeBracket, 1, container);
 			}
@@ -1047,7 +1401,7 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Pars
 }
 
 template<typename T>
-constexpr void formatter::arg_formatter::ArgFormatter::ParseFormatString(std::back_insert_iterator<T>&& Iter, const std::locale& loc, std::string_view sv) {
+constexpr void formatter::arg_formatter::ArgFormatter::ParseFormatString(std::back_insert_iterator<T>&& Iter, const locale_type& loc, std::string_view sv) {
 	if( !std::is_constant_evaluated() ) {
 			std::memset(buffer.data(), 0, AF_ARG_BUFFER_SIZE);
 	} else {
@@ -1059,11 +1413,13 @@ constexpr void formatter::arg_formatter::ArgFormatter::ParseFormatString(std::ba
 	auto& container { internal_helper::IteratorAccessHelper(std::move(Iter)).Container() };
 	for( ;; ) {
 			specValues.ResetSpecs();
+			// the time formatting paths append to the buffer rather than overwrite it, so anything left over from the last field has to go
+			valueSize = 0;
 			const auto& storage { argStorage.isCustomFormatter ? customStorage : argStorage };
 			// Check small sv size conditions and handle the niche cases, otherwise break and continue onward
 			switch( sv.size() ) {
 					case 0: return;
-					case 1: WriteToContainer(sv, 1, container); return;
+					case 1: WriteReferenceToContainer(sv, 1, container); return;
 					case 2:
 						// Handle If format string only contains '{}' and no other text
 						if( sv[ 0 ] == '{' && sv[ 1 ] == '}' ) {
@@ -1080,20 +1436,21 @@ constexpr void formatter::arg_formatter::ArgFormatter::ParseFormatString(std::ba
 						}
 						// Otherwise, write out any remaining characters as-is and bypass the check that would have found
 						// this case in FindBrackets(). In most cases, ending early here saw ~2-3% gain in performance
-						WriteToContainer(sv, 2, container);
+						WriteReferenceToContainer(sv, 2, container);
 						return;
 					default: break;
 				}
 			// If the above wasn't executed, then find the first pair of curly brackets and if none were found, write out the parse string as-is
 			if( !FindBrackets(sv) ) {
-					WriteToContainer(sv, sv.size(), container);
+					if( errHandle.failed ) return;
+					WriteReferenceToContainer(sv, sv.size(), container);
 					return;
 			}
 			// If the position of the first curly bracket found isn't the beginning of the parse string, then write the text as-is up until the bracket position
 			auto& begin { bracketResults.beginPos };
 			auto& end { bracketResults.endPos };
 			if( begin > 0 ) {
-					WriteToContainer(sv, begin, container);
+					WriteReferenceToContainer(sv, begin, container);
 					sv.remove_prefix(begin);
 					end -= begin;
 					begin = 0;
@@ -1110,7 +1467,10 @@ constexpr void formatter::arg_formatter::ArgFormatter::ParseFormatString(std::ba
 			//                argBracket[ bracketSize - 2 ] is used here to check if the position before the close bracket is another closing bracket instead.
 			if( bracketSize > 3 && argBracket[ bracketSize - 2 ] == '}' ) specValues.hasClosingBrace = true;
 			/************************************* Handle Positional Args *************************************/
-			if( !VerifyPositionalField(argBracket, pos, specValues.argPosition) ) {
+			auto hasSpecs { VerifyPositionalField(argBracket, pos, specValues.argPosition) };
+			// with try_format_to() the parsing functions record an error and return instead of reporting it, so nothing past a failed step can run
+			if( errHandle.failed ) return;
+			if( !hasSpecs ) {
 					// Nothing Else to Parse- just a simple substitution after position field so write it and continue parsing format string
 					switch( const auto& argType { storage.SpecTypesCaptured()[ specValues.argPosition ] } ) {
 							case SpecType::CustomType:
@@ -1140,13 +1500,18 @@ constexpr void formatter::arg_formatter::ArgFormatter::ParseFormatString(std::ba
 						}
 					case SpecType::CTimeType:
 						ParseTimeField(argBracket, pos);
+						if( errHandle.failed ) return;
 						FormatTimeField(container, loc);
 						break;
+					case SpecType::RangeType: FormatRange(container, argBracket.substr(pos)); break;
 					default:
 						Parse(argBracket, pos, argType);
+						if( errHandle.failed ) return;
 						Format(container, loc, argType);
 						break;
 				}
+			// a custom formatter's nested calls and a range's element spec can fail too
+			if( errHandle.failed ) return;
 			if( specValues.hasClosingBrace ) {
 					WriteToContainer(closeBracket, 1, container);
 			}
@@ -1154,6 +1519,156 @@ constexpr void formatter::arg_formatter::ArgFormatter::ParseFormatString(std::ba
 		}
 }
 
+/************************************************************************ Batch Formatting ************************************************************************/
+template<typename T, typename Rows>
+void formatter::arg_formatter::ArgFormatter::format_rows_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, const Rows& rows) {
+	auto& container { internal_helper::IteratorAccessHelper(std::move(Iter)).Container() };
+	auto first { std::ranges::begin(rows) };
+	FormatBatch(container, sv, static_cast<size_t>(std::ranges::size(rows)), [ & ](size_t row) {
+		std::apply([ & ](const auto&... args) { CaptureArgs(std::back_inserter(container), args...); }, first[ row ]);
+	});
+}
+
+template<typename T, typename... Columns>
+void formatter::arg_formatter::ArgFormatter::format_columns_to(std::back_insert_iterator<T>&& Iter, std::string_view sv, const Columns&... columns) {
+	static_assert(sizeof...(Columns) > 0, "At Least One Column Is Needed To Format A Batch");
+	auto& container { internal_helper::IteratorAccessHelper(std::move(Iter)).Container() };
+	auto rowCount { std::min({ static_cast<size_t>(std::ranges::size(columns))... }) };
+	FormatBatch(container, sv, rowCount, [ & ](size_t row) { CaptureArgs(std::back_inserter(container), std::ranges::begin(columns)[ row ]...); });
+}
+
+template<typename T, typename RowCapture>
+void formatter::arg_formatter::ArgFormatter::FormatBatch(T& container, std::string_view sv, size_t rowCount, RowCapture&& captureRow) {
+	if( rowCount == 0 ) return;
+	lastRootCounter = argCounter;
+	std::memset(buffer.data(), 0, AF_ARG_BUFFER_SIZE);
+	valueSize = 0;
+	// every row has the same argument types, so the first row's types are the ones the format string is parsed against
+	captureRow(0);
+	CompileFormatString(sv);
+	// rows formatted with the same format string tend to be close in size, so reserve for the rest of them off of the first one
+	if constexpr( requires { container.reserve(size_t {}); } ) {
+			auto startSize { container.size() };
+			FormatCompiled(container);
+			auto rowSize { container.size() - startSize };
+			container.reserve(container.size() + rowSize * (rowCount - 1) + (rowSize * (rowCount - 1)) / 8);
+	} else {
+			FormatCompiled(container);
+		}
+	for( size_t row { 1 }; row < rowCount; ++row ) {
+			captureRow(row);
+			FormatCompiled(container);
+		}
+	argStorage.isCustomFormatter = false;
+	argCounter                   = lastRootCounter;
+}
+
+// Mirrors the parsing half of ParseFormatString(), recording what would have been written instead of writing it
+inline void formatter::arg_formatter::ArgFormatter::CompileFormatString(std::string_view sv) {
+	using enum CompiledFieldKind;
+	compiledFields.clear();
+	argCounter  = 0;
+	m_indexMode = IndexMode::automatic;
+	auto addField { [ this ](CompiledFieldKind kind, std::string_view text, size_t parsePos = 0) {
+		auto argType { kind == Literal ? SpecType::MonoType : argStorage.SpecTypesCaptured()[ specValues.argPosition ] };
+		compiledFields.push_back(CompiledField { kind, argType, text, parsePos, argCounter, specValues });
+	} };
+	for( ;; ) {
+			specValues.ResetSpecs();
+			switch( sv.size() ) {
+					case 0: return;
+					case 1: addField(Literal, sv); return;
+					case 2:
+						if( sv[ 0 ] == '{' && sv[ 1 ] == '}' ) {
+								addField(argStorage.SpecTypesCaptured()[ 0 ] == SpecType::CustomType ? Custom : Simple, sv);
+								return;
+						}
+						addField(Literal, sv);
+						return;
+					default: break;
+				}
+			if( !FindBrackets(sv) ) {
+					addField(Literal, sv);
+					return;
+			}
+			auto& begin { bracketResults.beginPos };
+			auto& end { bracketResults.endPos };
+			if( begin > 0 ) {
+					addField(Literal, sv.substr(0, begin));
+					sv.remove_prefix(begin);
+					end -= begin;
+					begin = 0;
+			}
+			size_t pos { 0 };
+			auto bracketSize { end - begin };
+			std::string_view argBracket(sv.data() + 1, sv.data() + bracketSize + 1);
+			if( argBracket[ pos ] == '{' ) {
+					addField(Literal, closeBracket);
+					++pos;
+			}
+			if( bracketSize > 3 && argBracket[ bracketSize - 2 ] == '}' ) specValues.hasClosingBrace = true;
+			if( !VerifyPositionalField(argBracket, pos, specValues.argPosition) ) {
+					switch( argStorage.SpecTypesCaptured()[ specValues.argPosition ] ) {
+							case SpecType::CustomType: addField(Custom, argBracket); break;
+							case SpecType::CTimeType: addField(SimpleTime, argBracket); break;
+							default: addField(Simple, argBracket); break;
+						}
+					sv.remove_prefix(bracketSize + 1);
+					continue;
+			}
+			switch( const auto& argType { argStorage.SpecTypesCaptured()[ specValues.argPosition ] } ) {
+					case SpecType::CustomType: addField(Custom, argBracket); break;
+					case SpecType::CTimeType:
+						// recorded before parsing so that replaying it starts from the same state; parsed here anyways so errors surface up front
+						addField(Time, argBracket, pos);
+						ParseTimeField(argBracket, pos);
+						break;
+					case SpecType::RangeType: addField(Range, argBracket.substr(pos)); break;
+					default:
+						Parse(argBracket, pos, argType);
+						addField(Spec, argBracket);
+						break;
+				}
+			sv.remove_prefix(bracketSize + 1);
+		}
+}
+
+// Mirrors the formatting half of ParseFormatString() for the fields recorded by CompileFormatString()
+template<typename T> void formatter::arg_formatter::ArgFormatter::FormatCompiled(T&& container) {
+	using enum CompiledFieldKind;
+	for( const auto& field: compiledFields ) {
+			if( field.kind == Literal ) {
+					WriteReferenceToContainer(field.text, field.text.size(), container);
+					continue;
+			}
+			specValues = field.specs;
+			valueSize  = 0;
+			switch( field.kind ) {
+					case Simple: WriteSimpleValue(container, field.argType); break;
+					case SimpleTime: WriteSimpleCTime(container); break;
+					case Spec: Format(container, field.argType); break;
+					case Range: FormatRange(container, field.text); break;
+					case Time:
+						{
+							auto pos { field.parsePos };
+							argCounter = field.argIndex;
+							ParseTimeField(field.text, pos);
+							FormatTimeField(container);
+							break;
+						}
+					case Custom:
+						argStorage.isCustomFormatter = true;
+						argStorage.custom_state(field.specs.argPosition).FormatCallBack(field.text);
+						argStorage.isCustomFormatter = false;
+						break;
+					default: break;
+				}
+			if( field.specs.hasClosingBrace ) {
+					WriteToContainer(closeBracket, 1, container);
+			}
+		}
+}
+
 inline constexpr bool formatter::arg_formatter::ArgFormatter::FindBrackets(std::string_view sv) {
 	const auto svSize { sv.size() };
 	if( svSize < 3 ) return false;
@@ -1166,22 +1681,27 @@ inline constexpr bool formatter::arg_formatter::ArgFormatter::FindBrackets(std::
 		}
 	end = begin;
 	for( ;; ) {
-			if( ++end >= svSize ) errHandle.ReportError(af_errors::ErrorType::missing_bracket);
+			if( ++end >= svSize ) break;
 			switch( sv[ end ] ) {
 					case '}': return true; break;
 					case '{':
 						for( ;; ) {
-								if( ++end >= svSize ) errHandle.ReportError(af_errors::ErrorType::missing_bracket);
+								if( ++end >= svSize ) break;
 								if( sv[ end ] != '}' ) continue;
 								for( ;; ) {
-										if( ++end >= svSize ) errHandle.ReportError(af_errors::ErrorType::missing_bracket);
+										if( ++end >= svSize ) break;
 										if( sv[ end ] != '}' ) continue;
 										return true;
 									}
+								break;
 							}
+						break;
 					default: continue;
 				}
+			break;
 		}
+	errHandle.ReportParseError(af_errors::ErrorType::missing_bracket);
+	return false;
 }
 
 inline constexpr bool formatter::arg_formatter::ArgFormatter::VerifyPositionalField(std::string_view sv, size_t& start, unsigned char& positionValue) {
@@ -1219,7 +1739,7 @@ inline constexpr bool formatter::arg_formatter::ArgFormatter::VerifyPositionalFi
 								++start;
 								return true;
 								break;
-							default: errHandle.ReportError(af_errors::ErrorType::position_field_spec); break;
+							default: errHandle.ReportParseError(af_errors::ErrorType::position_field_spec); break;
 						}
 			}
 	} else {
@@ -1234,11 +1754,11 @@ inline constexpr bool formatter::arg_formatter::ArgFormatter::VerifyPositionalFi
 								++start;
 								return true;
 							case '}': ++start; return false;
-							default: errHandle.ReportError(af_errors::ErrorType::position_field_mode); break;
+							default: errHandle.ReportParseError(af_errors::ErrorType::position_field_mode); break;
 						}
 			} else {
 					switch( sv[ start ] ) {
-							case '}': errHandle.ReportError(af_errors::ErrorType::position_field_mode); break;
+							case '}': errHandle.ReportParseError(af_errors::ErrorType::position_field_mode); break;
 							case ' ':
 								{
 									auto size { sv.size() };
@@ -1249,50 +1769,61 @@ inline constexpr bool formatter::arg_formatter::ArgFormatter::VerifyPositionalFi
 									return VerifyPositionalField(sv, start, positionValue);
 									break;
 								}
-							case ':': errHandle.ReportError(af_errors::ErrorType::position_field_no_position); break;
-							default: errHandle.ReportError(af_errors::ErrorType::position_field_runon); break;
+							case ':': errHandle.ReportParseError(af_errors::ErrorType::position_field_no_position); break;
+							default: errHandle.ReportParseError(af_errors::ErrorType::position_field_runon); break;
 						}
 				}
 		}
-	errHandle.ReportError(af_errors::ErrorType::none);
+	// only reached through an error above, in which case this one is dropped in favor of it
+	errHandle.ReportParseError(af_errors::ErrorType::none);
+	return false;
 }
 
-inline constexpr void formatter::arg_formatter::ArgFormatter::OnAlignLeft(const char& ch, size_t& pos) {
+inline constexpr void formatter::arg_formatter::ArgFormatter::SetFillCharacter(std::string_view fill) {
+	// as with std::format, the fill has to be exactly one well-formed code point rather than whatever bytes came before the alignment
+	char32_t codePoint {};
+	if( fill.empty() || formatter::unicode::DecodeUtf8(fill, codePoint) != fill.size() ) {
+			return errHandle.ReportParseError(af_errors::ErrorType::invalid_fill_character);
+	}
+	specValues.fillSize = static_cast<unsigned char>(fill.size());
+	std::copy_n(fill.data(), fill.size(), specValues.fillCharacter.data());
+}
+
+inline constexpr void formatter::arg_formatter::ArgFormatter::OnAlignLeft(std::string_view fill, size_t& pos) {
 	specValues.align = Alignment::AlignLeft;
 	++pos;
-	if( ch == ':' ) {
-			specValues.fillCharacter = ' ';
-	} else if( ch != '{' && ch != '}' ) {
-			specValues.fillCharacter = ch;
+	if( fill == ":" ) {
+			SetFillCharacter(" ");
+	} else if( fill != "{" && fill != "}" ) {
+			SetFillCharacter(fill);
 	} else {
-			errHandle.ReportError(af_errors::ErrorType::invalid_fill_character);
+			errHandle.ReportParseError(af_errors::ErrorType::invalid_fill_character);
 		}
 }
-inline constexpr void formatter::arg_formatter::ArgFormatter::OnAlignRight(const char& ch, size_t& pos) {
+inline constexpr void formatter::arg_formatter::ArgFormatter::OnAlignRight(std::string_view fill, size_t& pos) {
 	specValues.align = Alignment::AlignRight;
 	++pos;
-	if( ch == ':' ) {
-			specValues.fillCharacter = ' ';
-	} else if( ch != '{' && ch != '}' ) {
-			specValues.fillCharacter = ch;
+	if( fill == ":" ) {
+			SetFillCharacter(" ");
+	} else if( fill != "{" && fill != "}" ) {
+			SetFillCharacter(fill);
 	} else {
-			errHandle.ReportError(af_errors::ErrorType::invalid_fill_character);
+			errHandle.ReportParseError(af_errors::ErrorType::invalid_fill_character);
 		}
 }
-inline constexpr void formatter::arg_formatter::ArgFormatter::OnAlignCenter(const char& ch, size_t& pos) {
+inline constexpr void formatter::arg_formatter::ArgFormatter::OnAlignCenter(std::string_view fill, size_t& pos) {
 	specValues.align = Alignment::AlignCenter;
 	++pos;
-	if( ch == ':' ) {
-			specValues.fillCharacter = ' ';
-	} else if( ch != '{' && ch != '}' ) {
-			specValues.fillCharacter = ch;
+	if( fill == ":" ) {
+			SetFillCharacter(" ");
+	} else if( fill != "{" && fill != "}" ) {
+			SetFillCharacter(fill);
 	} else {
-			errHandle.ReportError(af_errors::ErrorType::invalid_fill_character);
+			errHandle.ReportParseError(af_errors::ErrorType::invalid_fill_character);
 		}
 }
-inline constexpr void formatter::arg_formatter::ArgFormatter::OnAlignDefault(const SpecType& argType, size_t& pos) {
+inline constexpr void formatter::arg_formatter::ArgFormatter::OnAlignDefault(const SpecType& argType) {
 	using enum msg_details::SpecType;
-	--pos;
 	switch( argType ) {
 			case MonoType: return;
 			case IntType: [[fallthrough]];
@@ -1304,18 +1835,20 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::OnAlignDefault(con
 			case U_LongLongType: specValues.align = Alignment::AlignRight; break;
 			default: specValues.align = Alignment::AlignLeft; break;
 		}
-	specValues.fillCharacter = ' ';
+	// the fill is left unset so that a '0' flag can still tell that no alignment was given; the padding writers default it to a space
 }
 
 inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyFillAlignField(std::string_view sv, size_t& currentPos, const msg_details::SpecType& argType) {
-	const auto& ch { sv[ currentPos ] };
+	// the fill can be any single code point, so the alignment that goes with it comes after however many bytes the fill takes up
+	auto fill { FillSequence(sv, currentPos) };
 	// handle padding with and without argument to pad
 	/*
 	    format("{:*5}")        results in -> *****
 	    format("{:*5}", 'a')  results in -> a****
 	*/
 	if( argType == SpecType::MonoType ) {
-			specValues.fillCharacter = ch;
+			SetFillCharacter(fill);
+			currentPos += fill.size() - 1;
 			// for monotype cases, don't have to worry about alignment, so just check if the position needs to be adjusted or not
 			switch( ++currentPos >= sv.size() ? sv.back() : sv[ currentPos ] ) {
 					default: return;
@@ -1325,11 +1858,20 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyFillAlignFie
 				}
 	}
 
+	currentPos += fill.size() - 1;
 	switch( ++currentPos >= sv.size() ? '}' : sv[ currentPos ] ) {
-			case '<': OnAlignLeft(ch, currentPos); return;
-			case '>': OnAlignRight(ch, currentPos); return;
-			case '^': OnAlignCenter(ch, currentPos); return;
-			default: OnAlignDefault(argType, currentPos); return;
+			case '<': OnAlignLeft(fill, currentPos); return;
+			case '>': OnAlignRight(fill, currentPos); return;
+			case '^': OnAlignCenter(fill, currentPos); return;
+			default:
+				// no fill, so either the alignment comes on its own or there's neither
+				currentPos -= fill.size();
+				switch( sv[ currentPos ] ) {
+						case '<': OnAlignLeft(" ", currentPos); return;
+						case '>': OnAlignRight(" ", currentPos); return;
+						case '^': OnAlignCenter(" ", currentPos); return;
+						default: OnAlignDefault(argType); return;
+					}
 		}
 }
 
@@ -1345,7 +1887,7 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyAltField(con
 			case U_LongLongType: [[fallthrough]];
 			case CharType: [[fallthrough]];
 			case BoolType: specValues.hasAlt = true; return;
-			default: errHandle.ReportError(af_errors::ErrorType::invalid_alt_type); break;
+			default: errHandle.ReportParseError(af_errors::ErrorType::invalid_alt_type); break;
 		}
 }
 
@@ -1358,7 +1900,7 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyWidthField(s
 			switch( ch ) {
 					case '{': VerifyPositionalField(sv, ++currentPosition, specValues.nestedWidthArgPos); return;
 					case '}': VerifyPositionalField(sv, currentPosition, specValues.nestedWidthArgPos); return;
-					default: errHandle.ReportError(af_errors::ErrorType::missing_bracket); return;
+					default: return errHandle.ReportParseError(af_errors::ErrorType::missing_bracket);
 				}
 		}
 }
@@ -1372,18 +1914,17 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyPrecisionFie
 			case FloatType: [[fallthrough]];
 			case DoubleType: [[fallthrough]];
 			case LongDoubleType: break;
-			default: errHandle.ReportError(af_errors::ErrorType::invalid_precision_type); break;
+			default: return errHandle.ReportParseError(af_errors::ErrorType::invalid_precision_type);
 		}
 	if( const auto& ch { sv[ ++currentPosition ] }; IsDigit(ch) ) {
 			auto data { sv.data() };
 			currentPosition += se_from_chars(data + currentPosition, specValues.precision);
-			++argCounter;
 			return;
 	} else {
 			switch( ch ) {
 					case '{': VerifyPositionalField(sv, ++currentPosition, specValues.nestedPrecArgPos); return;
 					case '}': VerifyPositionalField(sv, currentPosition, specValues.nestedPrecArgPos); return;
-					default: errHandle.ReportError(af_errors::ErrorType::missing_bracket); return;
+					default: return errHandle.ReportParseError(af_errors::ErrorType::missing_bracket);
 				}
 		}
 }
@@ -1397,7 +1938,8 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::VerifyLocaleField(
 			case SpecType::MonoType: [[fallthrough]];
 			case SpecType::StringType: [[fallthrough]];
 			case SpecType::StringViewType: [[fallthrough]];
-			case SpecType::VoidPtrType: errHandle.ReportError(af_errors::ErrorType::invalid_locale_type); break;
+			case SpecType::RangeType: [[fallthrough]];
+			case SpecType::VoidPtrType: errHandle.ReportParseError(af_errors::ErrorType::invalid_locale_type); break;
 			default: specValues.localize = true; return;
 		}
 }
@@ -1407,12 +1949,12 @@ inline constexpr bool formatter::arg_formatter::ArgFormatter::IsSimpleSubstituti
 	switch( argType ) {
 			case StringType: [[fallthrough]];
 			case CharPointerType: [[fallthrough]];
-			case StringViewType: return prec == 0;
+			case StringViewType: return prec == 0 && specValues.typeSpec != 'j' && specValues.typeSpec != '?';
 			case IntType: [[fallthrough]];
 			case U_IntType: [[fallthrough]];
 			case LongLongType: [[fallthrough]];
 			case U_LongLongType: return !specValues.hasAlt && specValues.signType == Sign::Empty && !specValues.localize && specValues.typeSpec == '\0';
-			case BoolType: return !specValues.hasAlt && (specValues.typeSpec == '\0' || specValues.typeSpec == 's');
+			case BoolType: return !specValues.hasAlt && !specValues.localize && (specValues.typeSpec == '\0' || specValues.typeSpec == 's');
 			case CharType: return !specValues.hasAlt && (specValues.typeSpec == '\0' || specValues.typeSpec == 'c');
 			case FloatType: [[fallthrough]];
 			case DoubleType: [[fallthrough]];
@@ -1455,19 +1997,20 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::OnInvalidTypeSpec(
 			case IntType: [[fallthrough]];
 			case U_IntType: [[fallthrough]];
 			case LongLongType: [[fallthrough]];
-			case U_LongLongType: errHandle.ReportError(af_errors::ErrorType::invalid_int_spec); break;
+			case U_LongLongType: errHandle.ReportParseError(af_errors::ErrorType::invalid_int_spec); break;
 			case FloatType: [[fallthrough]];
 			case DoubleType: [[fallthrough]];
-			case LongDoubleType: errHandle.ReportError(af_errors::ErrorType::invalid_float_spec); break;
+			case LongDoubleType: errHandle.ReportParseError(af_errors::ErrorType::invalid_float_spec); break;
 			case StringType: [[fallthrough]];
 			case CharPointerType: [[fallthrough]];
-			case StringViewType: errHandle.ReportError(af_errors::ErrorType::invalid_string_spec); break;
-			case BoolType: errHandle.ReportError(af_errors::ErrorType::invalid_bool_spec); break;
-			case CharType: errHandle.ReportError(af_errors::ErrorType::invalid_char_spec); break;
+			case StringViewType: errHandle.ReportParseError(af_errors::ErrorType::invalid_string_spec); break;
+			case BoolType: errHandle.ReportParseError(af_errors::ErrorType::invalid_bool_spec); break;
+			case CharType: errHandle.ReportParseError(af_errors::ErrorType::invalid_char_spec); break;
 			case ConstVoidPtrType: [[fallthrough]];
-			case VoidPtrType: errHandle.ReportError(af_errors::ErrorType::invalid_pointer_spec); break;
+			case VoidPtrType: errHandle.ReportParseError(af_errors::ErrorType::invalid_pointer_spec); break;
 			case MonoType: [[fallthrough]];
 			case CustomType: [[fallthrough]];
+			case RangeType: [[fallthrough]];
 			case CTimeType: return;    // possibly issue warning on a af_typedefs::type spec being provided on no argument?
 			default: break;
 		}
@@ -1492,6 +2035,23 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::HandlePotentialTyp
 			case 's': [[fallthrough]];
 			case 'x': [[fallthrough]];
 			case 'X': OnValidTypeSpec(argType, ch); return;
+			case 'j':
+				// JSON escaping only applies to strings
+				switch( argType ) {
+						case SpecType::StringType: [[fallthrough]];
+						case SpecType::CharPointerType: [[fallthrough]];
+						case SpecType::StringViewType: OnValidTypeSpec(argType, ch); return;
+						default: OnInvalidTypeSpec(argType); return;
+					}
+			case '?':
+				// the debug spec escapes strings and chars
+				switch( argType ) {
+						case SpecType::StringType: [[fallthrough]];
+						case SpecType::CharPointerType: [[fallthrough]];
+						case SpecType::StringViewType: [[fallthrough]];
+						case SpecType::CharType: OnValidTypeSpec(argType, ch); return;
+						default: OnInvalidTypeSpec(argType); return;
+					}
 			default: OnInvalidTypeSpec(argType); return;
 		}
 }
@@ -1505,13 +2065,23 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Writ
 template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteSimpleCString(T&& container) {
 	const auto& storage { argStorage.isCustomFormatter ? customStorage : argStorage };
 	std::string_view sv { storage.c_string_state(specValues.argPosition) };
-	WriteToContainer(sv, sv.size(), std::forward<T>(container));
+	WriteReferenceToContainer(sv, sv.size(), std::forward<T>(container));
 }
 
 template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteSimpleStringView(T&& container) {
 	const auto& storage { argStorage.isCustomFormatter ? customStorage : argStorage };
 	std::string_view sv { storage.string_view_state(specValues.argPosition) };
-	WriteToContainer(sv, sv.size(), std::forward<T>(container));
+	WriteReferenceToContainer(sv, sv.size(), std::forward<T>(container));
+}
+
+// Used for text that's owned by the caller rather than by the formatter (literal text in the format string and string_view/c-string arguments). Reference
+// sinks get to point at it directly; every other container just gets a copy as usual.
+template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteReferenceToContainer(std::string_view sv, size_t size, T&& container) {
+	if constexpr( formatter::internal_helper::af_concepts::is_reference_sink_v<T> ) {
+			container.append_ref(sv.data(), size);
+	} else {
+			WriteToContainer(sv, size, std::forward<T>(container));
+		}
 }
 
 template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteSimpleInt(T&& container) {
@@ -2108,19 +2678,173 @@ template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::Writ
 			case U_LongLongType: WriteSimpleULongLong(std::forward<T>(container)); return;
 			case BoolType: WriteSimpleBool(std::forward<T>(container)); return;
 			case CharType:
-				container.insert(container.end(),
-				                 (argStorage.isCustomFormatter ? customStorage.char_state(specValues.argPosition) : argStorage.char_state(specValues.argPosition)));
+				if constexpr( formatter::internal_helper::af_concepts::is_format_sink_v<T> ) {
+						container.push_back(argStorage.isCustomFormatter ? customStorage.char_state(specValues.argPosition)
+						                                                 : argStorage.char_state(specValues.argPosition));
+				} else {
+						container.insert(container.end(),
+						                 (argStorage.isCustomFormatter ? customStorage.char_state(specValues.argPosition) : argStorage.char_state(specValues.argPosition)));
+					}
 				return;
 			case FloatType: WriteSimpleFloat(std::forward<T>(container)); return;
 			case DoubleType: WriteSimpleDouble(std::forward<T>(container)); return;
 			case LongDoubleType: WriteSimpleLongDouble(std::forward<T>(container)); return;
 			case ConstVoidPtrType: WriteSimpleConstVoidPtr(std::forward<T>(container)); return;
 			case VoidPtrType: WriteSimpleVoidPtr(std::forward<T>(container)); return;
+			case RangeType: FormatRange(std::forward<T>(container), closeBracket); return;
 			default: return;
 		}
 }
 
+// 'spec' is everything in the field after the range's ':' (or just the closing bracket): an optional 'n' to drop the brackets, then optionally ':'
+// followed by the spec to format every element with
+template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::FormatRange(T&& container, std::string_view spec) {
+	using enum msg_details::SpecType;
+	auto& storage { argStorage.isCustomFormatter ? customStorage : argStorage };
+	auto fieldSpecs { specValues };
+	// copied since the range's own argument slot is reused to hold each element while it's being formatted
+	auto range { storage.range_state(fieldSpecs.argPosition) };
+	if( range.isByteRange && !spec.empty() ) {
+			switch( spec[ 0 ] ) {
+					case 'x': [[fallthrough]];
+					case 'X': [[fallthrough]];
+					case 'h': [[fallthrough]];
+					case 'H': [[fallthrough]];
+					case 'b': FormatByteRange(container, spec, range); return;
+					default: break;
+				}
+	}
+	size_t pos { 0 };
+	auto withBrackets { true };
+	if( pos < spec.size() && spec[ pos ] == 'n' ) {
+			withBrackets = false;
+			++pos;
+	}
+	auto hasElementSpec { false };
+	if( pos < spec.size() && spec[ pos ] != '}' ) {
+			if( spec[ pos ] != ':' ) return errHandle.ReportParseError(af_errors::ErrorType::invalid_range_spec);
+			spec.remove_prefix(pos + 1);
+			hasElementSpec = !spec.empty() && spec[ 0 ] != '}';
+	}
+	if( withBrackets ) WriteToContainer(range.opening, range.opening.size(), container);
+	if( !hasElementSpec && range.FillBlock != nullptr && range.separator.size() <= AF_RANGE_BLOCK_SIZE / 2 ) {
+			// numeric elements with no spec of their own skip the argument slots and the per-element dispatch entirely
+			std::array<char, AF_RANGE_BLOCK_SIZE> block;
+			for( size_t index { 0 }; index < range.size; ) {
+					auto used { range.FillBlock(range.data, index, range.size, range.separator, block.data(), block.size()) };
+					WriteToContainer(std::string_view(block.data(), used), used, container);
+				}
+	} else {
+			auto elementType { range.elementType == StringType ? StringViewType : range.elementType };
+			if( hasElementSpec ) {
+					size_t elementPos { 0 };
+					specValues.ResetSpecs();
+					specValues.argPosition = fieldSpecs.argPosition;
+					Parse(spec, elementPos, elementType);
+					if( errHandle.failed ) return;
+			}
+			auto elementSpecs { specValues };
+			auto& slot { storage.ArgStorage()[ fieldSpecs.argPosition ] };
+			for( size_t index { 0 }; index < range.size; ++index ) {
+					if( index != 0 ) WriteToContainer(range.separator, range.separator.size(), container);
+					range.StoreElement(range.data, index, &slot);
+					specValues = elementSpecs;
+					valueSize  = 0;
+					hasElementSpec ? Format(container, elementType) : WriteSimpleValue(container, elementType);
+				}
+			slot = range;
+		}
+	if( withBrackets ) WriteToContainer(range.closing, range.closing.size(), container);
+	specValues = fieldSpecs;
+}
+
+// Byte ranges accept 'x'/'X' for the bytes as one run of hex digits, optionally followed by a group size that places a space between every group of
+// that many bytes ("{:x4}" -> "deadbeef 01020304"), 'h'/'H' for a 'hexdump -C' style dump of 16 bytes per line with their offset and ascii text, and
+// 'b64' for the bytes' padded base64 encoding
+template<typename T>
+constexpr void formatter::arg_formatter::ArgFormatter::FormatByteRange(T&& container, std::string_view spec, const internal_helper::RangeValue& range) {
+	namespace se_con = utf_utils::utf_constraints;
+	using CharType = typename formatter::internal_helper::af_typedefs::type<T>::value_type;
+	auto upper { spec[ 0 ] == 'X' || spec[ 0 ] == 'H' };
+	auto dump { spec[ 0 ] == 'h' || spec[ 0 ] == 'H' };
+	auto base64 { spec[ 0 ] == 'b' };
+	size_t group { 0 }, pos { 1 };
+	if( base64 ) {
+			if( !spec.substr(1).starts_with("64") ) return errHandle.ReportParseError(af_errors::ErrorType::invalid_range_spec);
+			pos = 3;
+	} else {
+			for( ; pos < spec.size() && IsDigit(spec[ pos ]); ++pos ) group = group * 10 + static_cast<size_t>(spec[ pos ] - '0');
+			if( dump && pos != 1 ) return errHandle.ReportParseError(af_errors::ErrorType::invalid_range_spec);
+		}
+	if( pos < spec.size() && spec[ pos ] != '}' ) return errHandle.ReportParseError(af_errors::ErrorType::invalid_range_spec);
+	auto bytes { static_cast<const unsigned char*>(range.data) };
+	// 'dest' must have room for 3 chars per byte when grouping, 2 per byte when not, 96 per line when dumping and 4 per 3 bytes for base64
+	auto encode { [ bytes, upper, dump, base64, group ](size_t first, size_t count, char* dest) -> char* {
+		if( base64 ) return simd::Base64Encode(bytes + first, count, dest);
+		if( dump ) {
+				for( auto end { first + count }; first < end; first += AF_HEXDUMP_LINE_WIDTH ) {
+						auto lineSize { std::min(AF_HEXDUMP_LINE_WIDTH, end - first) };
+						std::array<char, 16> offset;
+						auto offsetEnd { std::to_chars(offset.data(), offset.data() + offset.size(), first, 16).ptr };
+						auto offsetSize { static_cast<size_t>(offsetEnd - offset.data()) };
+						if( offsetSize < 8 ) {
+								std::memset(dest, '0', 8 - offsetSize);
+								dest += 8 - offsetSize;
+						}
+						for( auto digit { offset.data() }; digit != offsetEnd; ++digit ) {
+								*dest++ = upper && *digit >= 'a' ? static_cast<char>(*digit - ('a' - 'A')) : *digit;
+							}
+						std::array<char, AF_HEXDUMP_LINE_WIDTH * 2> digits;
+						simd::HexEncode(bytes + first, lineSize, digits.data(), upper);
+						std::memset(dest, ' ', 52);
+						dest += 2;
+						for( size_t i { 0 }; i < lineSize; ++i ) {
+								auto column { dest + i * 3 + (i >= 8 ? 1 : 0) };
+								column[ 0 ] = digits[ i * 2 ];
+								column[ 1 ] = digits[ i * 2 + 1 ];
+							}
+						dest += 50;
+						*dest++ = '|';
+						for( size_t i { 0 }; i < lineSize; ++i ) {
+								auto ch { bytes[ first + i ] };
+								*dest++ = ch >= 0x20 && ch < 0x7F ? static_cast<char>(ch) : '.';
+							}
+						*dest++ = '|';
+						*dest++ = '\n';
+					}
+				return dest;
+		}
+		if( group == 0 ) return simd::HexEncode(bytes + first, count, dest, upper);
+		for( auto end { first + count }; first < end; ) {
+				if( first != 0 && first % group == 0 ) *dest++ = ' ';
+				auto run { std::min(group - first % group, end - first) };
+				dest = simd::HexEncode(bytes + first, run, dest, upper);
+				first += run;
+			}
+		return dest;
+	} };
+	auto maxSize { [ dump, base64 ](size_t count) {
+		return base64 ? (count + 2) / 3 * 4 : dump ? (count + AF_HEXDUMP_LINE_WIDTH - 1) / AF_HEXDUMP_LINE_WIDTH * 96 : count * 3;
+	} };
+	if constexpr( std::is_same_v<CharType, char> && (se_con::is_string_v<T> || se_con::is_vector_v<T>) ) {
+			// grow the container once and convert straight into it
+			auto start { container.size() };
+			container.resize(start + maxSize(range.size));
+			auto end { encode(0, range.size, container.data() + start) };
+			container.resize(static_cast<size_t>(end - container.data()));
+	} else {
+			std::array<char, AF_RANGE_BLOCK_SIZE> block;
+			// chunks stay whole lines for dumps and whole 3 byte groups for base64 so that splitting the bytes up doesn't change the output
+			auto chunkSize { base64 ? AF_RANGE_BLOCK_SIZE / 4 * 3 : dump ? AF_RANGE_BLOCK_SIZE / 96 * AF_HEXDUMP_LINE_WIDTH : AF_RANGE_BLOCK_SIZE / 3 };
+			for( size_t first { 0 }; first < range.size; first += chunkSize ) {
+					auto used { static_cast<size_t>(encode(first, std::min(chunkSize, range.size - first), block.data()) - block.data()) };
+					WriteToContainer(std::string_view(block.data(), used), used, container);
+				}
+		}
+}
+
 inline constexpr void formatter::arg_formatter::ArgFormatter::FormatCharType(const char& value) {
+	if( specValues.typeSpec == '?' ) return WriteDebugChar(value);
 	specValues.typeSpec != '\0' && specValues.typeSpec != 'c' ? FormatIntegerType(static_cast<int>(value)) : WriteChar(value);
 }
 
@@ -2144,14 +2868,16 @@ constexpr void formatter::arg_formatter::ArgFormatter::FormatPointerType(T&& val
 				{
 					auto data { buffer.data() };
 					std::memcpy(data, sv.data(), 2);
-					valueSize = std::to_chars(data + 2, data + buffer.size(), reinterpret_cast<size_t>(std::forward<T>(value)), 16).ptr - data;
+					auto address { reinterpret_cast<size_t>(std::forward<T>(value)) };
+					valueSize = simd::WriteHexDigits(address, CountDigits(address, 16), data + 2, false) - data;
 					return;
 				}
 			case VoidPtrType:
 				{
 					auto data { buffer.data() };
 					std::memcpy(data, sv.data(), 2);
-					valueSize = std::to_chars(data + 2, data + buffer.size(), reinterpret_cast<size_t>(std::forward<T>(value)), 16).ptr - data;
+					auto address { reinterpret_cast<size_t>(std::forward<T>(value)) };
+					valueSize = simd::WriteHexDigits(address, CountDigits(address, 16), data + 2, false) - data;
 					return;
 				}
 			default: return;
@@ -2179,8 +2905,8 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::FormatArgument(con
 
 inline constexpr void formatter::arg_formatter::ArgFormatter::BufferToUpper(char* begin, const char* end) {
 	// Bypassing a check on every char and only matching these cases is slightly faster and uses considerably less CPU cycles.
-	// Since this is being used explicitly to convert hex values and the case 'p' (for floating point cases), these are the only
-	// values that are of any concern to check here.
+	// Since this is only used for floating point values, the hex digits, the 'p' and 'x' of hex floats and the letters of "inf"
+	// and "nan" are the only values that are of any concern to check here.
 	for( ;; ) {
 			if( begin == end ) return;
 			switch( *begin ) {
@@ -2190,6 +2916,8 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::BufferToUpper(char
 					case 'd': [[fallthrough]];
 					case 'e': [[fallthrough]];
 					case 'f': [[fallthrough]];
+					case 'i': [[fallthrough]];
+					case 'n': [[fallthrough]];
 					case 'p': [[fallthrough]];
 					case 'x': *begin++ -= 32; continue;
 					default: ++begin; continue;
@@ -2252,7 +2980,13 @@ inline constexpr void formatter::arg_formatter::ArgFormatter::SetFloatingFormat(
 template<typename T>
 requires std::is_arithmetic_v<std::remove_cvref_t<T>>
 constexpr void formatter::arg_formatter::ArgFormatter::WriteSign(T&& value, int& pos) {
-	switch( specValues.signType == Sign::Space ? value < 0 ? Sign::Minus : Sign::Space : specValues.signType ) {
+	// std::to_chars() writes the minus sign of a negative value itself, which for floating point values includes -0.0 and negative NaNs
+	if constexpr( std::is_floating_point_v<std::remove_cvref_t<T>> ) {
+			if( std::signbit(value) ) return;
+	} else {
+			if( value < 0 ) return;
+		}
+	switch( specValues.signType ) {
 			case Sign::Space: buffer[ pos++ ] = ' '; return;
 			case Sign::Plus: buffer[ pos++ ] = '+'; return;
 			case Sign::Empty: [[fallthrough]];
@@ -2294,6 +3028,15 @@ constexpr void formatter::arg_formatter::ArgFormatter::FormatFloatType(T&& value
 	!std::is_constant_evaluated() ? static_cast<void>(std::memset(data, 0, AF_ARG_BUFFER_SIZE)) : std::fill(buffer.begin(), buffer.end(), 0);
 	if( specValues.signType != Sign::Empty ) WriteSign(std::forward<T>(value), pos);
 	SetFloatingFormat(format, precision, isUpper);
+	// finite values have no letters to upper case in fixed notation, so 'F' takes the fast path too
+	if constexpr( sizeof(std::remove_cvref_t<T>) <= sizeof(double) ) {
+			if( format == std::chars_format::fixed && precision != 0 ) {
+					if( auto fastEnd { WriteFixedPrecision(static_cast<double>(value), precision, data + pos) }; fastEnd != nullptr ) {
+							valueSize = fastEnd - data;
+							return;
+					}
+			}
+	}
 	auto end { precision != 0 ? std::to_chars(data + pos, data + AF_ARG_BUFFER_SIZE, value, format, precision).ptr
 		                      : std::to_chars(data + pos, data + AF_ARG_BUFFER_SIZE, value, format).ptr };
 	valueSize = end - data;
@@ -2303,42 +3046,138 @@ constexpr void formatter::arg_formatter::ArgFormatter::FormatFloatType(T&& value
 template<typename T>
 requires std::is_integral_v<std::remove_cvref_t<T>>
 constexpr void formatter::arg_formatter::ArgFormatter::FormatIntegerType(T&& value) {
+	using Unsigned = std::make_unsigned_t<std::remove_cvref_t<T>>;
 	int pos { 0 }, base { 10 };
 	bool isUpper { false };
 	auto data { buffer.data() };
 	!std::is_constant_evaluated() ? static_cast<void>(std::memset(data, 0, AF_ARG_BUFFER_SIZE)) : std::fill(buffer.begin(), buffer.end(), 0);
-	if( specValues.signType != Sign::Empty ) WriteSign(std::forward<T>(value), pos);
+	SetIntegralFormat(base, isUpper);
+	if( base == 10 ) {
+			if( specValues.signType != Sign::Empty ) WriteSign(std::forward<T>(value), pos);
+			valueSize = std::to_chars(data + pos, data + AF_ARG_BUFFER_SIZE, value).ptr - data;
+			return;
+	}
+	// the other bases write the magnitude so that a negative value's sign comes before its base prefix ("-0xff" rather than "0x-ff"), and they pick
+	// their digits' case up front rather than converting them afterwards
+	auto isNegative { false };
+	if constexpr( std::is_signed_v<std::remove_cvref_t<T>> ) isNegative = value < 0;
+	auto magnitude { isNegative ? static_cast<Unsigned>(Unsigned { 0 } - static_cast<Unsigned>(value)) : static_cast<Unsigned>(value) };
+	if( isNegative ) {
+			data[ pos++ ] = '-';
+	} else if( specValues.signType != Sign::Empty ) {
+			WriteSign(std::forward<T>(value), pos);
+		}
 	if( specValues.preAltForm.size() != 0 ) {
 			std::memcpy(data + pos, specValues.preAltForm.data(), specValues.preAltForm.size());
 			pos += static_cast<int>(specValues.preAltForm.size());    // safe to downcast as it will only ever be positive and max val of 2
 	}
-	SetIntegralFormat(base, isUpper);
-	auto end { std::to_chars(data + pos, data + AF_ARG_BUFFER_SIZE, value, base).ptr };
-	valueSize = end - data;
-	if( isUpper ) BufferToUpper(data, end);
+	valueSize = WriteDigits(magnitude, base, CountDigits(magnitude, base), data + pos, isUpper) - data;
 }
 
 template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::FormatStringType(T&& container, std::string_view val, const int& precision) {
-	int size { static_cast<int>(val.size()) };
+	if( specValues.typeSpec == 'j' ) return WriteJsonEscaped(std::forward<T>(container), TruncateToPrecision(val, precision));
+	if( specValues.typeSpec == '?' ) {
+			if( precision == 0 ) return WriteDebugEscaped(std::forward<T>(container), val, '"');
+			// the precision counts the escaped text, quotes included, rather than the argument
+			escapedText.clear();
+			WriteDebugEscaped(escapedText, val, '"');
+			auto truncated { TruncateToPrecision(escapedText, precision) };
+			return WriteToContainer(truncated, truncated.size(), std::forward<T>(container));
+	}
+	// the precision is in display columns, so it's never allowed to cut a code point in half
+	val = TruncateToPrecision(val, precision);
 	using CharType = typename formatter::internal_helper::af_typedefs::type<T>::value_type;
-	if constexpr( std::is_same_v<CharType, char> ) {
-			WriteToContainer(val, precision, std::forward<T>(container));
-	} else if constexpr( std::is_same_v<CharType, char16_t> || (std::is_same_v<CharType, wchar_t> && sizeof(wchar_t) == 2) ) {
-			std::u16string tmp;
-			tmp.reserve(precision);
-			utf_utils::U8ToU16(val, tmp);
-			WriteToContainer(std::move(tmp), precision, std::forward<T>(container));
-	} else if constexpr( std::is_same_v<CharType, char32_t> || (std::is_same_v<CharType, wchar_t> && sizeof(wchar_t) == 4) ) {
-			std::u32string tmp;
-			tmp.reserve(precision);
-			utf_utils::U8ToU32(val, tmp);
-			WriteToContainer(std::move(tmp), precision, std::forward<T>(container));
+	if constexpr( std::is_same_v<CharType, char> || std::is_same_v<CharType, char16_t> || std::is_same_v<CharType, char32_t> ||
+	              std::is_same_v<CharType, wchar_t> ) {
+			// utf-16 and utf-32 containers are transcoded into directly
+			WriteToContainer(val, val.size(), std::forward<T>(container));
 	} else {
 			auto iter { std::back_inserter(std::forward<T>(container)) };
-			std::copy(val.data(), val.data() + (precision != 0 ? precision > size ? size : precision : size), iter);
+			std::copy(val.data(), val.data() + val.size(), iter);
 		}
 }
 
+// Writes 'val' as the contents of a JSON string: the runs of text that don't need escaping, found with a vectorized scan, are written as-is and only
+// '"', '\\' and control characters are replaced with their escape sequences. The surrounding quotes are left to the format string.
+template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteJsonEscaped(T&& container, std::string_view val) {
+	constexpr std::string_view hexDigits { "0123456789abcdef" };
+	while( !val.empty() ) {
+			auto clean { std::is_constant_evaluated() ? simd::simd_helper::FindJsonEscapeScalar(val.data(), 0, val.size())
+				                                      : simd::FindJsonEscape(val.data(), val.size()) };
+			if( clean != 0 ) WriteToContainer(val.substr(0, clean), clean, container);
+			if( clean == val.size() ) return;
+			std::array<char, 6> escape { '\\', '\0', '\0', '\0', '\0', '\0' };
+			size_t escapeSize { 2 };
+			switch( auto ch { static_cast<unsigned char>(val[ clean ]) } ) {
+					case '"': escape[ 1 ] = '"'; break;
+					case '\\': escape[ 1 ] = '\\'; break;
+					case '\b': escape[ 1 ] = 'b'; break;
+					case '\f': escape[ 1 ] = 'f'; break;
+					case '\n': escape[ 1 ] = 'n'; break;
+					case '\r': escape[ 1 ] = 'r'; break;
+					case '\t': escape[ 1 ] = 't'; break;
+					default:
+						escape     = { '\\', 'u', '0', '0', hexDigits[ ch >> 4 ], hexDigits[ ch & 0x0F ] };
+						escapeSize = 6;
+						break;
+				}
+			WriteToContainer(std::string_view(escape.data(), escapeSize), escapeSize, container);
+			val.remove_prefix(clean + 1);
+		}
+}
+
+// Writes 'val' the way the debug ('?') spec does: wrapped in 'delimiter' with '\t', '\n', '\r', '\\' and the delimiter escaped, ASCII control characters,
+// non-printable code points and leading combining marks written as '\u{hex}', and the bytes of ill-formed UTF-8 written as '\x{hex}'. Runs of plain ASCII
+// are found with a vectorized scan and written as-is.
+template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteDebugEscaped(T&& container, std::string_view val, char delimiter) {
+	WriteToContainer(std::string_view(&delimiter, 1), 1, container);
+	auto escaped { true };
+	while( !val.empty() ) {
+			auto clean { std::is_constant_evaluated() ? simd::simd_helper::FindDebugEscapeScalar(val.data(), 0, val.size(), delimiter)
+				                                      : simd::FindDebugEscape(val.data(), val.size(), delimiter) };
+			if( clean != 0 ) {
+					WriteToContainer(val.substr(0, clean), clean, container);
+					escaped = false;
+			}
+			if( clean == val.size() ) break;
+			val.remove_prefix(clean);
+			std::array<char, 12> sequence {};
+			size_t consumed { 0 };
+			auto written { DebugEscapeSequence(val, delimiter, escaped, consumed, sequence.data()) };
+			WriteToContainer(std::string_view(sequence.data(), written), written, container);
+			val.remove_prefix(consumed);
+		}
+	WriteToContainer(std::string_view(&delimiter, 1), 1, container);
+}
+
+inline constexpr void formatter::arg_formatter::ArgFormatter::WriteDebugChar(const char& value) {
+	auto escaped { true };
+	size_t consumed { 0 };
+	buffer[ valueSize++ ] = '\'';
+	valueSize += DebugEscapeSequence(std::string_view(&value, 1), '\'', escaped, consumed, buffer.data() + valueSize);
+	buffer[ valueSize++ ] = '\'';
+}
+
+template<typename T>
+constexpr void formatter::arg_formatter::ArgFormatter::FormatEscapedAlignment(T&& container, const SpecType& type, const int& totalWidth, const int& precision) {
+	using enum msg_details::SpecType;
+	auto& storage { argStorage.isCustomFormatter ? customStorage : argStorage };
+	std::string_view val;
+	switch( type ) {
+			case StringViewType: val = storage.string_view_state(specValues.argPosition); break;
+			case StringType: val = storage.string_state(specValues.argPosition); break;
+			case CharPointerType: val = storage.c_string_state(specValues.argPosition); break;
+			default: return;
+		}
+	escapedText.clear();
+	if( specValues.typeSpec == '?' ) {
+			WriteDebugEscaped(escapedText, val, '"');
+			return FormatAlignment(std::forward<T>(container), escapedText, totalWidth, precision);
+	}
+	WriteJsonEscaped(escapedText, TruncateToPrecision(val, precision));
+	FormatAlignment(std::forward<T>(container), escapedText, totalWidth, 0);
+}
+
 template<typename T> constexpr void formatter::arg_formatter::ArgFormatter::WriteFormattedString(T&& container, const SpecType& type, const int& precision) {
 	using enum msg_details::SpecType;
 	auto& storage { argStorage.isCustomFormatter ? customStorage : argStorage };
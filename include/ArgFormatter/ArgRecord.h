@@ -0,0 +1,128 @@
+#pragma once
+
+#include "ArgContainer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+
+/*********************************************************************************************************************************************************
+ * Deferred formatting splits a format call into a cheap capture step on the calling thread and the actual formatting work, which can then be done later
+ * and elsewhere. Capturing serializes the format string's pointer and size along with every argument into a compact, self-contained byte record:
+ * - numeric, bool, char and pointer arguments are copied as their raw bytes
+ * - std::tm arguments are copied as their nine standard int fields, leaving out padding and platform specific members
+ * - string arguments are copied inline (length, bytes and a null terminator) so the record doesn't reference the caller's memory
+ * - every argument is prefixed with the SpecType that GetArgType() classified it as, so nothing needs to be classified again on replay
+ * The format string itself is NOT copied and so must outlive the record (which string literals always do). Custom types can't be captured since
+ * their formatting can't be separated from the object they refer to.
+ *
+ * Record layout (native byte order, meant to be replayed in the same process):
+ *   [ u32 record size ][ u8 arg count ][ 3 bytes padding ][ format string pointer ][ format string size ][ args... ]
+ *   where each arg is [ u8 SpecType ][ payload ]
+ *********************************************************************************************************************************************************/
+namespace formatter::msg_details {
+
+	constexpr size_t AF_RECORD_HEADER_SIZE { 8 + sizeof(const char*) + sizeof(size_t) };
+
+	// Classification used for captured arguments; this reuses GetArgType() for everything it can construct a value of
+	template<typename T> constexpr SpecType RecordArgType() {
+		using base_type = internal_helper::af_typedefs::type<T>;
+		if constexpr( std::is_same_v<std::decay_t<base_type>, char*> || std::is_same_v<std::decay_t<base_type>, const char*> ) {
+				return SpecType::CharPointerType;
+		} else if constexpr( std::is_default_constructible_v<base_type> ) {
+				return GetArgType(base_type {});
+		} else {
+				return SpecType::CustomType;
+			}
+	}
+
+	class ArgRecordView
+	{
+	  public:
+		constexpr ArgRecordView() = default;
+		explicit ArgRecordView(std::span<const unsigned char> bytes);
+
+		[[nodiscard]] std::string_view FormatString() const;
+		[[nodiscard]] size_t ArgCount() const;
+		[[nodiscard]] size_t size() const;
+		// Calls 'visitor(value, SpecType)' for every captured argument in order; strings are handed back as std::string_view into the record itself.
+		// Returns false, having stopped at the first argument it couldn't read, if the record is truncated or holds an invalid type tag or value
+		template<typename Visitor> bool ForEachArg(Visitor&& visitor) const;
+
+	  private:
+		std::span<const unsigned char> record {};
+	};
+
+	class ArgRecord
+	{
+	  public:
+		ArgRecord() = default;
+		template<typename... Args> explicit ArgRecord(std::string_view sv, Args&&... args);
+		ArgRecord(const ArgRecord&)            = default;
+		ArgRecord& operator=(const ArgRecord&) = default;
+		ArgRecord(ArgRecord&&)                 = default;
+		ArgRecord& operator=(ArgRecord&&)      = default;
+		~ArgRecord()                           = default;
+
+		// Re-captures into this record, reusing its storage so repeated captures don't allocate once it has grown large enough
+		template<typename... Args> void Capture(std::string_view sv, Args&&... args);
+		[[nodiscard]] ArgRecordView View() const;
+		[[nodiscard]] std::span<const unsigned char> Bytes() const;
+
+		// The two halves of Capture() for callers that manage their own storage (ring buffers, arenas, etc...)
+		template<typename... Args> [[nodiscard]] static size_t EncodedSize(std::string_view sv, const Args&... args);
+		template<typename... Args> static size_t Encode(unsigned char* dest, std::string_view sv, const Args&... args);
+
+	  private:
+		std::vector<unsigned char> bytes;
+	};
+
+	/*********************************************************************************************************************************************************
+	 * RecordRingBuffer is a bounded multi-producer, single-consumer queue of ArgRecords sized in bytes. Producers claim space with a single fetch_add on
+	 * the reserve position, encode the record in place and then publish it by storing its slot size into the slot header; the consumer walks the slots
+	 * in order, stops at the first one that hasn't been published yet, and zeroes what it consumed so that the headers read as unpublished on the next
+	 * lap. A producer whose claimed space is still in use waits on the consumer's tail position until it's been drained.
+	 *
+	 * Slot layout: [ u32 slot size (0 = unpublished, high bit = padding) ][ u32 unused ][ ArgRecord bytes ][ padding up to 8 byte alignment ]
+	 * A record that would straddle the end of the buffer is instead turned into padding and the producer claims space again.
+	 *********************************************************************************************************************************************************/
+	class RecordRingBuffer
+	{
+	  public:
+		// 'capacity' is rounded up to a power of two
+		explicit RecordRingBuffer(size_t capacity);
+		RecordRingBuffer(const RecordRingBuffer&)            = delete;
+		RecordRingBuffer& operator=(const RecordRingBuffer&) = delete;
+		~RecordRingBuffer()                                  = default;
+
+		// Safe to call from any number of threads; returns false only if the record is too large to ever fit in the buffer
+		template<typename... Args> bool Push(std::string_view sv, Args&&... args);
+		// Must only be called from one thread at a time. Calls 'onRecord(ArgRecordView)' for every published record in order and returns the count
+		template<typename Callback> size_t Drain(Callback&& onRecord);
+		[[nodiscard]] size_t Capacity() const;
+
+	  private:
+		static constexpr size_t slotHeaderSize { 8 };
+		static constexpr uint32_t paddingFlag { 0x8000'0000 };
+		// Claims 'slotSize' bytes and returns their offset, waiting on the consumer if they're still in use
+		inline size_t Reserve(size_t slotSize);
+		inline void Publish(size_t offset, uint32_t header);
+		inline uint32_t ReadHeader(size_t offset) const;
+
+	  private:
+		size_t capacity;
+		size_t mask;
+		std::unique_ptr<uint64_t[]> storage;
+		unsigned char* ring;
+		alignas(64) std::atomic<size_t> reservePos;
+		alignas(64) std::atomic<size_t> consumedPos;
+		alignas(64) size_t readPos;
+	};
+
+}    // namespace formatter::msg_details
+
+#include "ArgRecordImpl.h"
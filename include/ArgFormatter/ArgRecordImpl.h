@@ -0,0 +1,327 @@
+#pragma once
+
+#include "ArgRecord.h"
+
+namespace formatter::msg_details::record_helper {
+
+	// The type each SpecType's payload is stored as inside of a record
+	template<SpecType> struct record_storage;
+	template<> struct record_storage<SpecType::IntType>
+	{
+		using type = int;
+	};
+	template<> struct record_storage<SpecType::U_IntType>
+	{
+		using type = unsigned int;
+	};
+	template<> struct record_storage<SpecType::LongLongType>
+	{
+		using type = long long;
+	};
+	template<> struct record_storage<SpecType::U_LongLongType>
+	{
+		using type = unsigned long long;
+	};
+	template<> struct record_storage<SpecType::BoolType>
+	{
+		using type = bool;
+	};
+	template<> struct record_storage<SpecType::CharType>
+	{
+		using type = char;
+	};
+	template<> struct record_storage<SpecType::FloatType>
+	{
+		using type = float;
+	};
+	template<> struct record_storage<SpecType::DoubleType>
+	{
+		using type = double;
+	};
+	template<> struct record_storage<SpecType::LongDoubleType>
+	{
+		using type = long double;
+	};
+	template<> struct record_storage<SpecType::ConstVoidPtrType>
+	{
+		using type = const void*;
+	};
+	template<> struct record_storage<SpecType::VoidPtrType>
+	{
+		using type = void*;
+	};
+	template<> struct record_storage<SpecType::CTimeType>
+	{
+		using type = std::tm;
+	};
+	template<SpecType Type> using record_storage_t = typename record_storage<Type>::type;
+
+	// std::tm is stored as its nine standard fields rather than as raw bytes, which would also carry its padding and any platform specific members
+	// (glibc's 'tm_zone' is a pointer) into the record
+	constexpr size_t AF_RECORD_CTIME_SIZE { 9 * sizeof(int) };
+
+	template<SpecType Type> constexpr size_t RecordPayloadSize() {
+		if constexpr( Type == SpecType::CTimeType ) {
+				return AF_RECORD_CTIME_SIZE;
+		} else {
+				return sizeof(record_storage_t<Type>);
+			}
+	}
+
+	constexpr bool IsStringRecordType(SpecType type) {
+		return type == SpecType::StringType || type == SpecType::StringViewType || type == SpecType::CharPointerType;
+	}
+
+	template<typename T> constexpr SpecType CheckedRecordArgType() {
+		constexpr auto argType { RecordArgType<T>() };
+		static_assert(argType != SpecType::CustomType && argType != SpecType::MonoType,
+		              "Custom Type Arguments Can't Be Captured Into An ArgRecord; Format Them Before Capturing Or Format Synchronously Instead.");
+		static_assert(argType != SpecType::RangeType,
+		              "Range Arguments Can't Be Captured Into An ArgRecord Since Only A View Of The Range Is Stored; Format Them Synchronously Instead.");
+		return argType;
+	}
+
+	template<typename T> constexpr std::string_view StringArg(const T& arg) {
+		if constexpr( std::is_array_v<T> || std::is_pointer_v<T> ) {
+				return std::string_view(arg);
+		} else {
+				return std::string_view(arg.data(), arg.size());
+			}
+	}
+
+	template<typename T> constexpr size_t EncodedArgSize(const T& arg) {
+		constexpr auto argType { CheckedRecordArgType<T>() };
+		if constexpr( IsStringRecordType(argType) ) {
+				return 1 + sizeof(uint32_t) + StringArg(arg).size() + 1;
+		} else {
+				return 1 + RecordPayloadSize<argType>();
+			}
+	}
+
+	template<typename T> inline void WriteRaw(unsigned char*& dest, const T& value) {
+		std::memcpy(dest, &value, sizeof(T));
+		dest += sizeof(T);
+	}
+
+	template<typename T> inline T ReadRaw(const unsigned char*& src) {
+		T value;
+		std::memcpy(&value, src, sizeof(T));
+		src += sizeof(T);
+		return value;
+	}
+
+	inline void WriteCTime(unsigned char*& dest, const std::tm& time) {
+		for( auto field: { time.tm_sec, time.tm_min, time.tm_hour, time.tm_mday, time.tm_mon, time.tm_year, time.tm_wday, time.tm_yday, time.tm_isdst } ) {
+				WriteRaw(dest, field);
+			}
+	}
+
+	inline std::tm ReadCTime(const unsigned char*& src) {
+		std::tm time {};
+		for( auto field: { &time.tm_sec, &time.tm_min, &time.tm_hour, &time.tm_mday, &time.tm_mon, &time.tm_year, &time.tm_wday, &time.tm_yday, &time.tm_isdst } ) {
+				*field = ReadRaw<int>(src);
+			}
+		return time;
+	}
+
+	// Hands the next 'T' to 'visitor' if the record still has room for one
+	template<typename T, typename Visitor> inline bool VisitRaw(const unsigned char*& src, const unsigned char* end, Visitor& visitor, SpecType type) {
+		if( static_cast<size_t>(end - src) < sizeof(T) ) return false;
+		visitor(ReadRaw<T>(src), type);
+		return true;
+	}
+
+	template<typename T> inline void EncodeArg(unsigned char*& dest, const T& arg) {
+		constexpr auto argType { CheckedRecordArgType<T>() };
+		*dest++ = static_cast<unsigned char>(argType);
+		if constexpr( IsStringRecordType(argType) ) {
+				auto sv { StringArg(arg) };
+				WriteRaw(dest, static_cast<uint32_t>(sv.size()));
+				std::memcpy(dest, sv.data(), sv.size());
+				dest += sv.size();
+				*dest++ = '\0';
+		} else if constexpr( argType == SpecType::CTimeType ) {
+				WriteCTime(dest, arg);
+		} else {
+				WriteRaw(dest, static_cast<record_storage_t<argType>>(arg));
+			}
+	}
+
+}    // namespace formatter::msg_details::record_helper
+
+/************************************************************************** ArgRecord ***************************************************************************/
+template<typename... Args> formatter::msg_details::ArgRecord::ArgRecord(std::string_view sv, Args&&... args): bytes() {
+	Capture(sv, std::forward<Args>(args)...);
+}
+
+template<typename... Args> void formatter::msg_details::ArgRecord::Capture(std::string_view sv, Args&&... args) {
+	bytes.resize(EncodedSize(sv, args...));
+	Encode(bytes.data(), sv, args...);
+}
+
+inline formatter::msg_details::ArgRecordView formatter::msg_details::ArgRecord::View() const {
+	return ArgRecordView(bytes);
+}
+
+inline std::span<const unsigned char> formatter::msg_details::ArgRecord::Bytes() const {
+	return bytes;
+}
+
+template<typename... Args> size_t formatter::msg_details::ArgRecord::EncodedSize(std::string_view, const Args&... args) {
+	static_assert(sizeof...(Args) < MAX_ARG_COUNT, "Too Many Arguments Supplied To Formatting Function");
+	return (AF_RECORD_HEADER_SIZE + ... + record_helper::EncodedArgSize(args));
+}
+
+template<typename... Args> size_t formatter::msg_details::ArgRecord::Encode(unsigned char* dest, std::string_view sv, const Args&... args) {
+	using namespace record_helper;
+	auto start { dest };
+	auto recordSize { static_cast<uint32_t>(EncodedSize(sv, args...)) };
+	WriteRaw(dest, recordSize);
+	*dest++ = static_cast<unsigned char>(sizeof...(Args));
+	std::memset(dest, 0, 3);
+	dest += 3;
+	WriteRaw(dest, sv.data());
+	WriteRaw(dest, sv.size());
+	(EncodeArg(dest, args), ...);
+	return static_cast<size_t>(dest - start);
+}
+
+/************************************************************************ ArgRecordView *************************************************************************/
+inline formatter::msg_details::ArgRecordView::ArgRecordView(std::span<const unsigned char> bytes): record(bytes) {
+	AF_ASSERT(bytes.size() >= AF_RECORD_HEADER_SIZE, "Error Reading ArgRecord: Record Is Smaller Than Its Header");
+}
+
+inline std::string_view formatter::msg_details::ArgRecordView::FormatString() const {
+	auto src { record.data() + 8 };
+	auto data { record_helper::ReadRaw<const char*>(src) };
+	auto size { record_helper::ReadRaw<size_t>(src) };
+	return std::string_view(data, size);
+}
+
+inline size_t formatter::msg_details::ArgRecordView::ArgCount() const {
+	return record[ 4 ];
+}
+
+inline size_t formatter::msg_details::ArgRecordView::size() const {
+	auto src { record.data() };
+	return record_helper::ReadRaw<uint32_t>(src);
+}
+
+template<typename Visitor> bool formatter::msg_details::ArgRecordView::ForEachArg(Visitor&& visitor) const {
+	using namespace record_helper;
+	using enum SpecType;
+	if( ArgCount() >= MAX_ARG_COUNT ) return false;
+	auto src { record.data() + AF_RECORD_HEADER_SIZE };
+	auto end { record.data() + record.size() };
+	// every read is checked against the end of the record first since a record replayed from a file can be truncated or corrupted
+	auto fits { [ & ](size_t size) { return static_cast<size_t>(end - src) >= size; } };
+	for( size_t i { 0 }; i < ArgCount(); ++i ) {
+			if( !fits(1) ) return false;
+			bool read { false };
+			switch( static_cast<SpecType>(*src++) ) {
+					case StringType: [[fallthrough]];
+					case StringViewType: [[fallthrough]];
+					case CharPointerType:
+						{
+							if( !fits(sizeof(uint32_t)) ) return false;
+							auto size { ReadRaw<uint32_t>(src) };
+							if( !fits(size_t { size } + 1) || src[ size ] != '\0' ) return false;
+							visitor(std::string_view(reinterpret_cast<const char*>(src), size), StringViewType);
+							src += size_t { size } + 1;
+							read = true;
+							break;
+						}
+					case IntType: read = VisitRaw<int>(src, end, visitor, IntType); break;
+					case U_IntType: read = VisitRaw<unsigned int>(src, end, visitor, U_IntType); break;
+					case LongLongType: read = VisitRaw<long long>(src, end, visitor, LongLongType); break;
+					case U_LongLongType: read = VisitRaw<unsigned long long>(src, end, visitor, U_LongLongType); break;
+					case BoolType:
+						// any byte other than 0 or 1 isn't a valid bool representation
+						if( !fits(1) || *src > 1 ) return false;
+						visitor(*src++ == 1, BoolType);
+						read = true;
+						break;
+					case CharType: read = VisitRaw<char>(src, end, visitor, CharType); break;
+					case FloatType: read = VisitRaw<float>(src, end, visitor, FloatType); break;
+					case DoubleType: read = VisitRaw<double>(src, end, visitor, DoubleType); break;
+					case LongDoubleType: read = VisitRaw<long double>(src, end, visitor, LongDoubleType); break;
+					case ConstVoidPtrType: read = VisitRaw<const void*>(src, end, visitor, ConstVoidPtrType); break;
+					case VoidPtrType: read = VisitRaw<void*>(src, end, visitor, VoidPtrType); break;
+					case CTimeType:
+						if( !fits(AF_RECORD_CTIME_SIZE) ) return false;
+						visitor(ReadCTime(src), CTimeType);
+						read = true;
+						break;
+					default: break;
+				}
+			if( !read ) return false;
+		}
+	return true;
+}
+
+/*********************************************************************** RecordRingBuffer ***********************************************************************/
+inline formatter::msg_details::RecordRingBuffer::RecordRingBuffer(size_t size)
+	: capacity(std::bit_ceil(std::max(size, size_t { 64 }))), mask(capacity - 1), storage(std::make_unique<uint64_t[]>(capacity / sizeof(uint64_t))),
+	  ring(reinterpret_cast<unsigned char*>(storage.get())), reservePos(0), consumedPos(0), readPos(0) { }
+
+inline size_t formatter::msg_details::RecordRingBuffer::Capacity() const {
+	return capacity;
+}
+
+inline size_t formatter::msg_details::RecordRingBuffer::Reserve(size_t slotSize) {
+	auto pos { reservePos.fetch_add(slotSize, std::memory_order_relaxed) };
+	for( auto consumed { consumedPos.load(std::memory_order_acquire) }; pos + slotSize - consumed > capacity;
+	     consumed = consumedPos.load(std::memory_order_acquire) )
+		{
+			consumedPos.wait(consumed, std::memory_order_acquire);
+		}
+	return pos;
+}
+
+inline void formatter::msg_details::RecordRingBuffer::Publish(size_t offset, uint32_t header) {
+	std::atomic_ref<uint32_t>(*reinterpret_cast<uint32_t*>(ring + offset)).store(header, std::memory_order_release);
+}
+
+inline uint32_t formatter::msg_details::RecordRingBuffer::ReadHeader(size_t offset) const {
+	return std::atomic_ref<uint32_t>(*reinterpret_cast<uint32_t*>(ring + offset)).load(std::memory_order_acquire);
+}
+
+template<typename... Args> bool formatter::msg_details::RecordRingBuffer::Push(std::string_view sv, Args&&... args) {
+	auto recordSize { ArgRecord::EncodedSize(sv, args...) };
+	auto slotSize { (slotHeaderSize + recordSize + 7) & ~size_t { 7 } };
+	if( slotSize > capacity ) return false;
+	for( ;; ) {
+			auto offset { Reserve(slotSize) & mask };
+			if( auto untilEnd { capacity - offset }; untilEnd < slotSize ) {
+					// the claimed space wraps around the end of the buffer, so publish both halves of it as padding and claim space again
+					Publish(0, static_cast<uint32_t>(slotSize - untilEnd) | paddingFlag);
+					Publish(offset, static_cast<uint32_t>(untilEnd) | paddingFlag);
+					continue;
+			}
+			ArgRecord::Encode(ring + offset + slotHeaderSize, sv, args...);
+			Publish(offset, static_cast<uint32_t>(slotSize));
+			return true;
+		}
+}
+
+template<typename Callback> size_t formatter::msg_details::RecordRingBuffer::Drain(Callback&& onRecord) {
+	size_t drained { 0 };
+	auto start { readPos };
+	for( ;; ) {
+			auto offset { readPos & mask };
+			auto header { ReadHeader(offset) };
+			if( header == 0 ) break;
+			auto slotSize { static_cast<size_t>(header & ~paddingFlag) };
+			if( (header & paddingFlag) == 0 ) {
+					onRecord(ArgRecordView(std::span<const unsigned char>(ring + offset + slotHeaderSize, slotSize - slotHeaderSize)));
+					++drained;
+			}
+			std::memset(ring + offset, 0, slotSize);
+			readPos += slotSize;
+		}
+	if( readPos != start ) {
+			consumedPos.store(readPos, std::memory_order_release);
+			consumedPos.notify_all();
+	}
+	return drained;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "ArgUnicode.h"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSSE3__) || defined(__SSE2__)
+	#include <immintrin.h>
+#endif
+
+/*********************************************************************************************************************************************************
+ * Vectorized kernels for the byte-buffer formatting paths. Which kernel is used is decided at compile time from the instruction sets the build targets
+ * (-mssse3, -mavx2, /arch:AVX2, -march=native, etc...), so a build that doesn't enable them gets the table-based scalar kernel instead. The hex kernels
+ * split every byte into its two nibbles and use each nibble as a shuffle index into a 16 byte table of digits, converting 16 (SSSE3) or 32 (AVX2)
+ * bytes per step before interleaving the high and low digits back into their written order. The base64 kernels spread every 3 input bytes over 4 bytes,
+ * pull the four 6 bit indices out of them with a pair of 16 bit multiplies and then turn the indices into their characters with one shuffle of offsets.
+ * The escape scans compare 16 (SSE2) or 32 (AVX2) chars at a time against the characters of interest and only drop down to looking at single chars
+ * once a block's mask says one of them is in it; the non-ASCII scan is the same thing with just the sign bit of every char. The transcoder widens
+ * whole blocks of ASCII straight into the destination and only decodes code point by code point from the first non-ASCII byte of a block. Integer digits
+ * in bases 2, 8 and 16 are written right to left a group of bits at a time: two hex digits per byte from the same pair table the scalar hex kernel
+ * uses, two octal digits per 6 bits from a 64 entry table, and eight binary digits per byte by spreading its bits across the lanes of a 64 bit word
+ * with a multiply.
+ *********************************************************************************************************************************************************/
+namespace formatter::simd {
+
+	// Writes two hex digits for every byte in 'src' to 'dest', which must have room for 2 * size chars, and returns one past the last char written
+	inline char* HexEncode(const unsigned char* src, size_t size, char* dest, bool upper);
+	// Writes the standard (RFC 4648, padded) base64 encoding of 'src' to 'dest', which must have room for 4 * ceil(size / 3) chars, and returns one past
+	// the last char written; splitting the input into multiples of 3 bytes gives the same output as encoding it all at once
+	inline char* Base64Encode(const unsigned char* src, size_t size, char* dest);
+	// Returns the index of the first char in 'data' that has to be escaped inside of a JSON string ('"', '\\' or a control character below 0x20), or
+	// 'size' if there isn't one
+	inline size_t FindJsonEscape(const char* data, size_t size);
+	// Returns the index of the first char in 'data' that the debug ('?') spec has to look at more closely ('\\', 'delimiter', an ASCII control
+	// character or any non-ASCII byte), or 'size' if there isn't one
+	inline size_t FindDebugEscape(const char* data, size_t size, char delimiter);
+	// Returns the index of the first non-ASCII byte in 'data', or 'size' if it's all ASCII
+	inline size_t FindNonAscii(const char* data, size_t size);
+	// Transcodes the UTF-8 in 'src' to UTF-16 or UTF-32, depending on the size of 'Unit', into 'dest' and returns how many units were written. Neither
+	// encoding ever needs more units than UTF-8 needs bytes, so 'dest' must have room for 'size' units. Each byte of ill-formed UTF-8 becomes U+FFFD.
+	template<typename Unit> inline size_t TranscodeUtf8(const char* src, size_t size, Unit* dest);
+	// Write exactly 'digits' digits of 'value' to 'dest', zero extended on the left if 'digits' is more than the value needs, and return one past the
+	// last char written; 'digits' must be at least the number the value needs
+	inline char* WriteHexDigits(uint64_t value, size_t digits, char* dest, bool upper);
+	inline char* WriteOctalDigits(uint64_t value, size_t digits, char* dest);
+	inline char* WriteBinaryDigits(uint64_t value, size_t digits, char* dest);
+
+	namespace simd_helper {
+		inline char* HexEncodeScalar(const unsigned char* src, size_t size, char* dest, bool upper);
+		inline char* Base64EncodeScalar(const unsigned char* src, size_t size, char* dest);
+		inline size_t FindJsonEscapeScalar(const char* data, size_t pos, size_t size);
+		inline size_t FindDebugEscapeScalar(const char* data, size_t pos, size_t size, char delimiter);
+		inline size_t FindNonAsciiScalar(const char* data, size_t pos, size_t size);
+		template<typename Unit> inline void WidenAscii(const char* src, size_t& pos, size_t size, Unit* dest, size_t& written);
+		template<typename Unit> inline size_t EncodeCodePoint(const char* src, size_t& pos, size_t size, Unit* dest);
+		inline char* WriteHexDigitsScalar(uint64_t value, size_t digits, char* dest, bool upper);
+		inline uint64_t SpreadBits(uint64_t byte);
+#if defined(__AVX2__)
+		inline char* HexEncodeAvx2(const unsigned char*& src, size_t& size, char* dest, bool upper);
+		inline char* Base64EncodeAvx2(const unsigned char*& src, size_t& size, char* dest);
+		inline size_t FindJsonEscapeAvx2(const char* data, size_t& pos, size_t size);
+		inline size_t FindDebugEscapeAvx2(const char* data, size_t& pos, size_t size, char delimiter);
+		inline size_t FindNonAsciiAvx2(const char* data, size_t& pos, size_t size);
+		template<typename Unit> inline bool WidenAsciiAvx2(const char* src, size_t& pos, size_t size, Unit* dest, size_t& written);
+#endif
+#if defined(__SSSE3__)
+		inline char* HexEncodeSsse3(const unsigned char*& src, size_t& size, char* dest, bool upper);
+		inline char* Base64EncodeSsse3(const unsigned char*& src, size_t& size, char* dest);
+#endif
+#if defined(__SSE2__)
+		inline size_t FindJsonEscapeSse2(const char* data, size_t& pos, size_t size);
+		inline size_t FindDebugEscapeSse2(const char* data, size_t& pos, size_t size, char delimiter);
+		inline size_t FindNonAsciiSse2(const char* data, size_t& pos, size_t size);
+		template<typename Unit> inline bool WidenAsciiSse2(const char* src, size_t& pos, size_t size, Unit* dest, size_t& written);
+#endif
+	}    // namespace simd_helper
+
+}    // namespace formatter::simd
+
+#include "ArgSimdImpl.h"
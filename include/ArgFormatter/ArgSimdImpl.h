@@ -0,0 +1,449 @@
+#pragma once
+
+#include "ArgSimd.h"
+
+namespace formatter::simd::simd_helper {
+
+	inline constexpr char lowerHexDigits[] { "0123456789abcdef" };
+	inline constexpr char upperHexDigits[] { "0123456789ABCDEF" };
+
+	// Both digits of every byte value, so the scalar kernel is a single lookup per byte
+	template<bool Upper> inline constexpr std::array<char, 512> hexPairs { [] {
+		std::array<char, 512> pairs {};
+		auto digits { Upper ? upperHexDigits : lowerHexDigits };
+		for( size_t value { 0 }; value < 256; ++value ) {
+				pairs[ value * 2 ]     = digits[ value >> 4 ];
+				pairs[ value * 2 + 1 ] = digits[ value & 0x0F ];
+			}
+		return pairs;
+	}() };
+
+	inline char* HexEncodeScalar(const unsigned char* src, size_t size, char* dest, bool upper) {
+		auto pairs { upper ? hexPairs<true>.data() : hexPairs<false>.data() };
+		for( auto end { src + size }; src != end; ++src, dest += 2 ) {
+				dest[ 0 ] = pairs[ *src * 2 ];
+				dest[ 1 ] = pairs[ *src * 2 + 1 ];
+			}
+		return dest;
+	}
+
+	// Writes the digits from right to left, a byte of the value at a time
+	inline char* WriteHexDigitsScalar(uint64_t value, size_t digits, char* dest, bool upper) {
+		auto pairs { upper ? hexPairs<true>.data() : hexPairs<false>.data() };
+		auto end { dest + digits };
+		auto pos { end };
+		for( ; pos - dest >= 2; value >>= 8 ) {
+				pos -= 2;
+				std::memcpy(pos, pairs + (value & 0xFF) * 2, 2);
+			}
+		if( pos != dest ) *--pos = pairs[ (value & 0x0F) * 2 + 1 ];
+		return end;
+	}
+
+	// Both octal digits of every 6 bit value
+	inline constexpr std::array<char, 128> octalPairs { [] {
+		std::array<char, 128> pairs {};
+		for( size_t value { 0 }; value < 64; ++value ) {
+				pairs[ value * 2 ]     = static_cast<char>('0' + (value >> 3));
+				pairs[ value * 2 + 1 ] = static_cast<char>('0' + (value & 7));
+			}
+		return pairs;
+	}() };
+
+	// Turns the 8 bits of 'byte' into the 8 chars of its binary digits, most significant first in memory. The multiply copies the byte into every lane,
+	// the mask keeps a different bit in each lane, and adding 0x7F carries any lane that kept its bit into that lane's high bit.
+	inline uint64_t SpreadBits(uint64_t byte) {
+		constexpr uint64_t bitPerLane { std::endian::native == std::endian::little ? 0x0102'0408'1020'4080 : 0x8040'2010'0804'0201 };
+		auto lanes { (byte * 0x0101'0101'0101'0101) & bitPerLane };
+		return (((lanes + 0x7F7F'7F7F'7F7F'7F7F) & 0x8080'8080'8080'8080) >> 7) | 0x3030'3030'3030'3030;
+	}
+
+	inline constexpr char base64Digits[] { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/" };
+
+	inline char* Base64EncodeScalar(const unsigned char* src, size_t size, char* dest) {
+		for( ; size >= 3; src += 3, size -= 3, dest += 4 ) {
+				auto bits { static_cast<uint32_t>(src[ 0 ]) << 16 | static_cast<uint32_t>(src[ 1 ]) << 8 | src[ 2 ] };
+				dest[ 0 ] = base64Digits[ bits >> 18 ];
+				dest[ 1 ] = base64Digits[ (bits >> 12) & 0x3F ];
+				dest[ 2 ] = base64Digits[ (bits >> 6) & 0x3F ];
+				dest[ 3 ] = base64Digits[ bits & 0x3F ];
+			}
+		if( size == 0 ) return dest;
+		auto bits { static_cast<uint32_t>(src[ 0 ]) << 16 | (size == 2 ? static_cast<uint32_t>(src[ 1 ]) << 8 : 0) };
+		dest[ 0 ] = base64Digits[ bits >> 18 ];
+		dest[ 1 ] = base64Digits[ (bits >> 12) & 0x3F ];
+		dest[ 2 ] = size == 2 ? base64Digits[ (bits >> 6) & 0x3F ] : '=';
+		dest[ 3 ] = '=';
+		return dest + 4;
+	}
+
+	inline size_t FindJsonEscapeScalar(const char* data, size_t pos, size_t size) {
+		for( ; pos < size; ++pos ) {
+				auto ch { static_cast<unsigned char>(data[ pos ]) };
+				if( ch < 0x20 || ch == '"' || ch == '\\' ) return pos;
+			}
+		return size;
+	}
+
+	inline size_t FindDebugEscapeScalar(const char* data, size_t pos, size_t size, char delimiter) {
+		for( ; pos < size; ++pos ) {
+				auto ch { static_cast<unsigned char>(data[ pos ]) };
+				if( ch < 0x20 || ch >= 0x7F || ch == '\\' || data[ pos ] == delimiter ) return pos;
+			}
+		return size;
+	}
+
+	// Checks 8 chars at a time for a set high bit before finding which char it was
+	inline size_t FindNonAsciiScalar(const char* data, size_t pos, size_t size) {
+		for( ; pos + 8 <= size; pos += 8 ) {
+				uint64_t word;
+				std::memcpy(&word, data + pos, 8);
+				if( (word & 0x8080'8080'8080'8080) != 0 ) break;
+			}
+		for( ; pos < size; ++pos ) {
+				if( static_cast<unsigned char>(data[ pos ]) >= 0x80 ) return pos;
+			}
+		return size;
+	}
+
+	// Writes the code point (or ill-formed byte) starting at 'pos' as UTF-16 or UTF-32, moves 'pos' past it and returns how many units were written
+	template<typename Unit> inline size_t EncodeCodePoint(const char* src, size_t& pos, size_t size, Unit* dest) {
+		char32_t codePoint {};
+		auto length { unicode::DecodeUtf8(std::string_view(src + pos, size - pos), codePoint) };
+		if( length == 0 ) {
+				codePoint = 0xFFFD;
+				length    = 1;
+		}
+		pos += length;
+		if constexpr( sizeof(Unit) == 2 ) {
+				if( codePoint >= 0x10000 ) {
+						codePoint -= 0x10000;
+						dest[ 0 ] = static_cast<Unit>(0xD800 + (codePoint >> 10));
+						dest[ 1 ] = static_cast<Unit>(0xDC00 + (codePoint & 0x3FF));
+						return 2;
+				}
+		}
+		dest[ 0 ] = static_cast<Unit>(codePoint);
+		return 1;
+	}
+
+	// Widens the run of ASCII starting at 'pos', using the widest kernel available for as much of it as there are whole blocks for
+	template<typename Unit> inline void WidenAscii(const char* src, size_t& pos, size_t size, Unit* dest, size_t& written) {
+#if defined(__AVX2__)
+		if( WidenAsciiAvx2(src, pos, size, dest, written) ) return;
+#endif
+#if defined(__SSE2__)
+		if( WidenAsciiSse2(src, pos, size, dest, written) ) return;
+#endif
+		for( ; pos < size && static_cast<unsigned char>(src[ pos ]) < 0x80; ++pos ) dest[ written++ ] = static_cast<Unit>(src[ pos ]);
+	}
+
+#if defined(__SSE2__)
+	// Returns the index of the first escape found in a whole 16 char block, otherwise advances 'pos' past every block checked and returns 'size'
+	inline size_t FindJsonEscapeSse2(const char* data, size_t& pos, size_t size) {
+		const auto quote { _mm_set1_epi8('"') };
+		const auto backslash { _mm_set1_epi8('\\') };
+		const auto lastControl { _mm_set1_epi8(0x1F) };
+		for( ; pos + 16 <= size; pos += 16 ) {
+				auto chars { _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)) };
+				// an unsigned char is at most 0x1F exactly when min(char, 0x1F) is the char itself
+				auto control { _mm_cmpeq_epi8(_mm_min_epu8(chars, lastControl), chars) };
+				auto special { _mm_or_si128(_mm_cmpeq_epi8(chars, quote), _mm_cmpeq_epi8(chars, backslash)) };
+				if( auto mask { static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(control, special))) }; mask != 0 ) {
+						return pos + static_cast<size_t>(std::countr_zero(mask));
+				}
+			}
+		return size;
+	}
+
+	// The same as FindJsonEscapeSse2() with the debug spec's set of chars; compared as signed chars, every byte that's at least 0x80 is negative, so
+	// one less-than catches those along with the control characters
+	inline size_t FindDebugEscapeSse2(const char* data, size_t& pos, size_t size, char delimiter) {
+		const auto quote { _mm_set1_epi8(delimiter) };
+		const auto backslash { _mm_set1_epi8('\\') };
+		const auto space { _mm_set1_epi8(0x20) };
+		const auto tilde { _mm_set1_epi8(0x7E) };
+		for( ; pos + 16 <= size; pos += 16 ) {
+				auto chars { _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)) };
+				auto outside { _mm_or_si128(_mm_cmplt_epi8(chars, space), _mm_cmpgt_epi8(chars, tilde)) };
+				auto special { _mm_or_si128(_mm_cmpeq_epi8(chars, quote), _mm_cmpeq_epi8(chars, backslash)) };
+				if( auto mask { static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(outside, special))) }; mask != 0 ) {
+						return pos + static_cast<size_t>(std::countr_zero(mask));
+				}
+			}
+		return size;
+	}
+
+	// Widens 16 chars at a time while they're all ASCII; the block holding the first non-ASCII byte is still widened in full, but only its ASCII prefix is
+	// kept since the code points after it overwrite the rest. Every store stays in bounds because 'written' never gets ahead of 'pos'. Returns whether it
+	// stopped at a non-ASCII byte rather than running out of whole blocks.
+	template<typename Unit> inline bool WidenAsciiSse2(const char* src, size_t& pos, size_t size, Unit* dest, size_t& written) {
+		const auto zero { _mm_setzero_si128() };
+		for( ; pos + 16 <= size; ) {
+				auto chars { _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)) };
+				auto mask { static_cast<unsigned int>(_mm_movemask_epi8(chars)) };
+				auto run { mask == 0 ? size_t { 16 } : static_cast<size_t>(std::countr_zero(mask)) };
+				if( run == 0 ) return true;
+				auto out { reinterpret_cast<__m128i*>(dest + written) };
+				auto low { _mm_unpacklo_epi8(chars, zero) };
+				auto high { _mm_unpackhi_epi8(chars, zero) };
+				if constexpr( sizeof(Unit) == 2 ) {
+						_mm_storeu_si128(out, low);
+						_mm_storeu_si128(out + 1, high);
+				} else {
+						_mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+						_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+						_mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+						_mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+					}
+				pos += run;
+				written += run;
+				if( mask != 0 ) return true;
+			}
+		return false;
+	}
+
+	// A char is non-ASCII exactly when its sign bit is set, so the movemask is the answer without any compares
+	inline size_t FindNonAsciiSse2(const char* data, size_t& pos, size_t size) {
+		for( ; pos + 16 <= size; pos += 16 ) {
+				if( auto mask { static_cast<unsigned int>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)))) }; mask != 0 ) {
+						return pos + static_cast<size_t>(std::countr_zero(mask));
+				}
+			}
+		return size;
+	}
+#endif
+
+#if defined(__SSSE3__)
+	// Takes 16 bytes that have 12 bytes of input in the low 12 and returns their 16 base64 characters
+	inline __m128i Base64EncodeBlock(__m128i input) {
+		// spread each 3 byte group over 4 bytes as [b1, b0, b2, b1] so that every 6 bit index sits within one 16 bit word
+		auto spread { _mm_shuffle_epi8(input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1)) };
+		auto high { _mm_mulhi_epu16(_mm_and_si128(spread, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040)) };
+		auto low { _mm_mullo_epi16(_mm_and_si128(spread, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010)) };
+		auto indices { _mm_or_si128(high, low) };
+		// map 0-25 -> 13, 26-51 -> 0, 52-61 -> 1-10, 62 -> 11, 63 -> 12 and shuffle in the offset that turns each range into its characters
+		auto ranges { _mm_subs_epu8(indices, _mm_set1_epi8(51)) };
+		ranges = _mm_or_si128(ranges, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+		const auto offsets { _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+			                               '+' - 62, '/' - 63, 'A', 0, 0) };
+		return _mm_add_epi8(_mm_shuffle_epi8(offsets, ranges), indices);
+	}
+#endif
+
+#if defined(__AVX2__)
+	// Consumes 24 bytes at a time, one 12 byte group per lane, while there's enough input left that the 16 byte loads stay in bounds
+	inline char* Base64EncodeAvx2(const unsigned char*& src, size_t& size, char* dest) {
+		for( ; size >= 28; src += 24, size -= 24, dest += 32 ) {
+				auto first { Base64EncodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))) };
+				auto second { Base64EncodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 12))) };
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm256_inserti128_si256(_mm256_castsi128_si256(first), second, 1));
+			}
+		return dest;
+	}
+
+	// The same as FindJsonEscapeSse2() with 32 char blocks
+	inline size_t FindJsonEscapeAvx2(const char* data, size_t& pos, size_t size) {
+		const auto quote { _mm256_set1_epi8('"') };
+		const auto backslash { _mm256_set1_epi8('\\') };
+		const auto lastControl { _mm256_set1_epi8(0x1F) };
+		for( ; pos + 32 <= size; pos += 32 ) {
+				auto chars { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos)) };
+				auto control { _mm256_cmpeq_epi8(_mm256_min_epu8(chars, lastControl), chars) };
+				auto special { _mm256_or_si256(_mm256_cmpeq_epi8(chars, quote), _mm256_cmpeq_epi8(chars, backslash)) };
+				if( auto mask { static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_or_si256(control, special))) }; mask != 0 ) {
+						return pos + static_cast<size_t>(std::countr_zero(mask));
+				}
+			}
+		return size;
+	}
+
+	// The same as FindDebugEscapeSse2() with 32 char blocks
+	inline size_t FindDebugEscapeAvx2(const char* data, size_t& pos, size_t size, char delimiter) {
+		const auto quote { _mm256_set1_epi8(delimiter) };
+		const auto backslash { _mm256_set1_epi8('\\') };
+		const auto space { _mm256_set1_epi8(0x20) };
+		const auto tilde { _mm256_set1_epi8(0x7E) };
+		for( ; pos + 32 <= size; pos += 32 ) {
+				auto chars { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos)) };
+				auto outside { _mm256_or_si256(_mm256_cmpgt_epi8(space, chars), _mm256_cmpgt_epi8(chars, tilde)) };
+				auto special { _mm256_or_si256(_mm256_cmpeq_epi8(chars, quote), _mm256_cmpeq_epi8(chars, backslash)) };
+				if( auto mask { static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_or_si256(outside, special))) }; mask != 0 ) {
+						return pos + static_cast<size_t>(std::countr_zero(mask));
+				}
+			}
+		return size;
+	}
+
+	// The same as WidenAsciiSse2() with 32 char blocks
+	template<typename Unit> inline bool WidenAsciiAvx2(const char* src, size_t& pos, size_t size, Unit* dest, size_t& written) {
+		for( ; pos + 32 <= size; ) {
+				auto chars { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + pos)) };
+				auto mask { static_cast<unsigned int>(_mm256_movemask_epi8(chars)) };
+				auto run { mask == 0 ? size_t { 32 } : static_cast<size_t>(std::countr_zero(mask)) };
+				if( run == 0 ) return true;
+				auto out { reinterpret_cast<__m256i*>(dest + written) };
+				auto low { _mm256_castsi256_si128(chars) };
+				auto high { _mm256_extracti128_si256(chars, 1) };
+				if constexpr( sizeof(Unit) == 2 ) {
+						_mm256_storeu_si256(out, _mm256_cvtepu8_epi16(low));
+						_mm256_storeu_si256(out + 1, _mm256_cvtepu8_epi16(high));
+				} else {
+						_mm256_storeu_si256(out, _mm256_cvtepu8_epi32(low));
+						_mm256_storeu_si256(out + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+						_mm256_storeu_si256(out + 2, _mm256_cvtepu8_epi32(high));
+						_mm256_storeu_si256(out + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+					}
+				pos += run;
+				written += run;
+				if( mask != 0 ) return true;
+			}
+		return false;
+	}
+
+	// The same as FindNonAsciiSse2() with 32 char blocks
+	inline size_t FindNonAsciiAvx2(const char* data, size_t& pos, size_t size) {
+		for( ; pos + 32 <= size; pos += 32 ) {
+				auto chars { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos)) };
+				if( auto mask { static_cast<unsigned int>(_mm256_movemask_epi8(chars)) }; mask != 0 ) {
+						return pos + static_cast<size_t>(std::countr_zero(mask));
+				}
+			}
+		return size;
+	}
+
+	// Consumes 32 bytes at a time and leaves the tail for the narrower kernels
+	inline char* HexEncodeAvx2(const unsigned char*& src, size_t& size, char* dest, bool upper) {
+		const auto digits { _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(upper ? upperHexDigits : lowerHexDigits))) };
+		const auto lowMask { _mm256_set1_epi8(0x0F) };
+		for( ; size >= 32; src += 32, size -= 32, dest += 64 ) {
+				auto bytes { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)) };
+				auto high { _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), lowMask)) };
+				auto low { _mm256_shuffle_epi8(digits, _mm256_and_si256(bytes, lowMask)) };
+				// the unpacks interleave within each 128 bit lane, so the lanes are put back in order before storing
+				auto first { _mm256_unpacklo_epi8(high, low) };
+				auto second { _mm256_unpackhi_epi8(high, low) };
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm256_permute2x128_si256(first, second, 0x20));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 32), _mm256_permute2x128_si256(first, second, 0x31));
+			}
+		return dest;
+	}
+#endif
+
+#if defined(__SSSE3__)
+	// Consumes 16 bytes at a time and leaves the tail for the scalar kernel
+	inline char* HexEncodeSsse3(const unsigned char*& src, size_t& size, char* dest, bool upper) {
+		const auto digits { _mm_loadu_si128(reinterpret_cast<const __m128i*>(upper ? upperHexDigits : lowerHexDigits)) };
+		const auto lowMask { _mm_set1_epi8(0x0F) };
+		for( ; size >= 16; src += 16, size -= 16, dest += 32 ) {
+				auto bytes { _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)) };
+				auto high { _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), lowMask)) };
+				auto low { _mm_shuffle_epi8(digits, _mm_and_si128(bytes, lowMask)) };
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_unpacklo_epi8(high, low));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16), _mm_unpackhi_epi8(high, low));
+			}
+		return dest;
+	}
+
+	// Consumes 12 bytes at a time while there's enough input left that the 16 byte load stays in bounds
+	inline char* Base64EncodeSsse3(const unsigned char*& src, size_t& size, char* dest) {
+		for( ; size >= 16; src += 12, size -= 12, dest += 16 ) {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dest), Base64EncodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))));
+			}
+		return dest;
+	}
+#endif
+
+}    // namespace formatter::simd::simd_helper
+
+inline char* formatter::simd::HexEncode(const unsigned char* src, size_t size, char* dest, bool upper) {
+#if defined(__AVX2__)
+	dest = simd_helper::HexEncodeAvx2(src, size, dest, upper);
+#endif
+#if defined(__SSSE3__)
+	dest = simd_helper::HexEncodeSsse3(src, size, dest, upper);
+#endif
+	return simd_helper::HexEncodeScalar(src, size, dest, upper);
+}
+
+inline char* formatter::simd::Base64Encode(const unsigned char* src, size_t size, char* dest) {
+#if defined(__AVX2__)
+	dest = simd_helper::Base64EncodeAvx2(src, size, dest);
+#endif
+#if defined(__SSSE3__)
+	dest = simd_helper::Base64EncodeSsse3(src, size, dest);
+#endif
+	return simd_helper::Base64EncodeScalar(src, size, dest);
+}
+
+inline size_t formatter::simd::FindJsonEscape(const char* data, size_t size) {
+	size_t pos { 0 };
+#if defined(__AVX2__)
+	if( auto found { simd_helper::FindJsonEscapeAvx2(data, pos, size) }; found != size ) return found;
+#endif
+#if defined(__SSE2__)
+	if( auto found { simd_helper::FindJsonEscapeSse2(data, pos, size) }; found != size ) return found;
+#endif
+	return simd_helper::FindJsonEscapeScalar(data, pos, size);
+}
+
+inline size_t formatter::simd::FindDebugEscape(const char* data, size_t size, char delimiter) {
+	size_t pos { 0 };
+#if defined(__AVX2__)
+	if( auto found { simd_helper::FindDebugEscapeAvx2(data, pos, size, delimiter) }; found != size ) return found;
+#endif
+#if defined(__SSE2__)
+	if( auto found { simd_helper::FindDebugEscapeSse2(data, pos, size, delimiter) }; found != size ) return found;
+#endif
+	return simd_helper::FindDebugEscapeScalar(data, pos, size, delimiter);
+}
+
+inline size_t formatter::simd::FindNonAscii(const char* data, size_t size) {
+	size_t pos { 0 };
+#if defined(__AVX2__)
+	if( auto found { simd_helper::FindNonAsciiAvx2(data, pos, size) }; found != size ) return found;
+#endif
+#if defined(__SSE2__)
+	if( auto found { simd_helper::FindNonAsciiSse2(data, pos, size) }; found != size ) return found;
+#endif
+	return simd_helper::FindNonAsciiScalar(data, pos, size);
+}
+
+template<typename Unit> inline size_t formatter::simd::TranscodeUtf8(const char* src, size_t size, Unit* dest) {
+	static_assert(sizeof(Unit) == 2 || sizeof(Unit) == 4, "Only UTF-16 And UTF-32 Code Units Are Supported");
+	size_t pos { 0 }, written { 0 };
+	while( pos < size ) {
+			simd_helper::WidenAscii(src, pos, size, dest, written);
+			if( pos == size ) break;
+			written += simd_helper::EncodeCodePoint(src, pos, size, dest + written);
+		}
+	return written;
+}
+
+// A 16 nibble shuffle was tried for 64 bit values but storing all 16 digits and then copying out the ones the value needs lost to the pair table
+inline char* formatter::simd::WriteHexDigits(uint64_t value, size_t digits, char* dest, bool upper) {
+	return simd_helper::WriteHexDigitsScalar(value, digits, dest, upper);
+}
+
+inline char* formatter::simd::WriteOctalDigits(uint64_t value, size_t digits, char* dest) {
+	auto end { dest + digits };
+	auto pos { end };
+	for( ; pos - dest >= 2; value >>= 6 ) {
+			pos -= 2;
+			std::memcpy(pos, simd_helper::octalPairs.data() + (value & 0x3F) * 2, 2);
+		}
+	if( pos != dest ) *--pos = static_cast<char>('0' + (value & 7));
+	return end;
+}
+
+inline char* formatter::simd::WriteBinaryDigits(uint64_t value, size_t digits, char* dest) {
+	auto end { dest + digits };
+	auto pos { end };
+	for( ; pos - dest >= 8; value >>= 8 ) {
+			pos -= 8;
+			auto chars { simd_helper::SpreadBits(value & 0xFF) };
+			std::memcpy(pos, &chars, 8);
+		}
+	for( ; pos != dest; value >>= 1 ) *--pos = static_cast<char>('0' + (value & 1));
+	return end;
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "ArgFormatter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <sys/uio.h>
+	#include <unistd.h>
+#endif
+
+/*********************************************************************************************************************************************************
+ * Sinks are output targets that the formatter can write directly into without first staging the result in a std::string. Any type that exposes a
+ * 'format_sink_tag' typedef along with 'append(const char*, size_t)' and 'push_back(char)' is accepted by format_to() via std::back_inserter(sink).
+ * The sinks in this file currently rely on POSIX file and memory-mapping facilities and are therefore not available on Windows builds.
+ *********************************************************************************************************************************************************/
+namespace formatter::sinks {
+
+#if !defined(_WIN32)
+	// Default growth step for the mapped region; large enough that remapping is a rare event even for multi-GB outputs
+	constexpr size_t AF_SINK_DEFAULT_GROWTH { 64 * 1024 * 1024 };
+	// Default capacity for the buffered file sinks
+	constexpr size_t AF_SINK_DEFAULT_BUFFER { 1024 * 1024 };
+	// Referenced text shorter than this is copied instead; below this size an extra iovec costs more than the copy it saves
+	constexpr size_t AF_SINK_REFERENCE_THRESHOLD { 64 };
+
+	// What an AsyncFileSink does when the active buffer is full and the writer thread hasn't finished with the other one yet
+	enum class Backpressure
+	{
+		Block = 0,    // wait for the writer thread to hand the other buffer back
+		Drop,         // discard the message currently being formatted and count it as dropped
+		Grow,         // grow the active buffer and keep going
+	};
+
+	/*********************************************************************************************************************************************************
+	 * MappedFileSink formats straight into a shared, memory-mapped view of the output file so that the formatted text lands in the page cache with no
+	 * intermediate copy. The file is grown in large page-aligned chunks via ftruncate() (and mremap() where available) and is truncated back down to the
+	 * exact number of bytes written when the sink is closed.
+	 *********************************************************************************************************************************************************/
+	class MappedFileSink
+	{
+	  public:
+		using value_type      = char;
+		using format_sink_tag = void;
+
+		explicit MappedFileSink(std::string_view path, size_t growthSize = AF_SINK_DEFAULT_GROWTH);
+		MappedFileSink(const MappedFileSink&)            = delete;
+		MappedFileSink& operator=(const MappedFileSink&) = delete;
+		MappedFileSink(MappedFileSink&& other) noexcept;
+		MappedFileSink& operator=(MappedFileSink&& other) noexcept;
+		~MappedFileSink();
+
+		inline void append(const char* data, size_t size);
+		inline void push_back(char ch);
+		// Ensures at least 'size' more bytes can be written without having to grow the mapping
+		void Reserve(size_t size);
+		void Close();
+		[[nodiscard]] inline size_t size() const;
+		[[nodiscard]] inline bool IsOpen() const;
+
+	  private:
+		void Grow(size_t required);
+		void Release() noexcept;
+
+	  private:
+		int fd;
+		char* mapping;
+		size_t mappedSize;
+		size_t writePos;
+		size_t growthChunk;
+		af_errors::error_handler errHandle;
+	};
+
+	/*********************************************************************************************************************************************************
+	 * FileSink is the synchronous counterpart to AsyncFileSink: formatted output is collected in a fixed-size buffer which is written out with write(2)
+	 * on the calling thread whenever it fills up, on Flush(), and on Close().
+	 *********************************************************************************************************************************************************/
+	class FileSink
+	{
+	  public:
+		using value_type      = char;
+		using format_sink_tag = void;
+
+		explicit FileSink(std::string_view path, size_t bufferSize = AF_SINK_DEFAULT_BUFFER);
+		FileSink(const FileSink&)            = delete;
+		FileSink& operator=(const FileSink&) = delete;
+		~FileSink();
+
+		inline void append(const char* data, size_t size);
+		inline void push_back(char ch);
+		void Flush();
+		void Close();
+		[[nodiscard]] inline size_t size() const;
+
+	  private:
+		int fd;
+		std::vector<char> buffer;
+		size_t bufferPos;
+		size_t totalWritten;
+		af_errors::error_handler errHandle;
+	};
+
+	/*********************************************************************************************************************************************************
+	 * AsyncFileSink keeps write(2) off of the formatting thread entirely. Output is formatted into the active buffer while a background thread writes out
+	 * the other one; the two are swapped through a single atomic state word rather than a mutex. Commit() marks the end of a message and is where a
+	 * handoff to the writer thread happens if it's idle, so messages are never split across a Drop. Messages committed while a write is in flight are
+	 * picked up by the writer itself once it's done, as long as the formatting thread isn't in the middle of the next message. While the writer does
+	 * that it owns the active buffer, so a call into the sink made in that window waits on the state word until the swap is done. That wait covers
+	 * a buffer swap, never a write(2); outside of Flush() and Close(), the formatting thread only waits on a write under Backpressure::Block with
+	 * both buffers full. This sink is meant to be fed from one thread at a time.
+	 *********************************************************************************************************************************************************/
+	class AsyncFileSink
+	{
+	  public:
+		using value_type      = char;
+		using format_sink_tag = void;
+
+		explicit AsyncFileSink(std::string_view path, size_t bufferSize = AF_SINK_DEFAULT_BUFFER, Backpressure policy = Backpressure::Block);
+		AsyncFileSink(const AsyncFileSink&)            = delete;
+		AsyncFileSink& operator=(const AsyncFileSink&) = delete;
+		~AsyncFileSink();
+
+		inline void append(const char* data, size_t size);
+		inline void push_back(char ch);
+		// Marks the end of the current message and hands the buffer to the writer thread if it's idle
+		void Commit();
+		// Hands off all committed messages and waits until they have been written
+		void Flush();
+		void Close();
+		[[nodiscard]] inline size_t DroppedCount() const;
+
+	  private:
+		enum HandoffState : unsigned int
+		{
+			writer_idle = 0,
+			writer_pending,
+			writer_shutdown,
+			writer_mask = 3,
+			// set by whichever thread currently owns the active buffer and the positions into it
+			front_owned = 4,
+			// committed messages are waiting in the active buffer for the writer to finish with the other one
+			handoff_waiting = 8,
+		};
+		void AcquireFront();
+		void ReleaseFront();
+		void MakeRoom(size_t size);
+		void SwapBuffers();
+		bool TryHandoff();
+		void WaitForWriter();
+		void DrainFront();
+		void WriterLoop();
+
+	  private:
+		int fd;
+		Backpressure policy;
+		std::vector<char> front;
+		std::vector<char> back;
+		size_t frontPos;
+		size_t committedPos;
+		size_t backSize;
+		size_t droppedMessages;
+		bool droppingMessage;
+		bool holdsFront;
+		std::atomic<unsigned int> state;
+		std::atomic<bool> writeFailed;
+		std::thread writer;
+		af_errors::error_handler errHandle;
+	};
+
+	/*********************************************************************************************************************************************************
+	 * ScatterGatherSink produces an iovec list instead of one contiguous buffer. Literal text from the format string and string_view, c-string and lvalue
+	 * std::string arguments are referenced in place, while numeric, padded and otherwise rendered fields are copied into a small scratch arena. The result
+	 * can be handed straight to writev() via WriteTo(). Anything referenced has to stay alive until the sink is written out or cleared.
+	 *********************************************************************************************************************************************************/
+	class ScatterGatherSink
+	{
+	  public:
+		using value_type      = char;
+		using format_sink_tag = void;
+
+		explicit ScatterGatherSink(size_t referenceThreshold = AF_SINK_REFERENCE_THRESHOLD);
+		ScatterGatherSink(const ScatterGatherSink&)            = delete;
+		ScatterGatherSink& operator=(const ScatterGatherSink&) = delete;
+		ScatterGatherSink(ScatterGatherSink&&)                 = default;
+		ScatterGatherSink& operator=(ScatterGatherSink&&)      = default;
+		~ScatterGatherSink()                                   = default;
+
+		inline void append(const char* data, size_t size);
+		inline void append_ref(const char* data, size_t size);
+		inline void push_back(char ch);
+		// The iovecs are only valid until the next write into the sink, since the arena may reallocate
+		std::span<const iovec> IoVecs();
+		void WriteTo(int fd);
+		void Clear();
+		[[nodiscard]] inline size_t size() const;
+
+	  private:
+		// Arena segments are stored as offsets and only resolved to pointers in IoVecs() so that arena growth can't invalidate them
+		struct Segment
+		{
+			const char* data;
+			size_t offset;
+			size_t size;
+		};
+
+	  private:
+		std::vector<Segment> segments;
+		std::vector<char> arena;
+		std::vector<iovec> ioVecs;
+		size_t totalSize;
+		size_t threshold;
+		af_errors::error_handler errHandle;
+	};
+#endif    // !_WIN32
+
+}    // namespace formatter::sinks
+
+#include "ArgSinksImpl.h"
@@ -0,0 +1,490 @@
+#pragma once
+
+#include "ArgSinks.h"
+
+#if !defined(_WIN32)
+
+namespace formatter::sinks::sink_helper {
+
+	inline size_t RoundToPageSize(size_t size) {
+		static const size_t pageSize { static_cast<size_t>(::sysconf(_SC_PAGESIZE)) };
+		return size == 0 ? pageSize : ((size + pageSize - 1) / pageSize) * pageSize;
+	}
+
+	// write(2) is allowed to write less than what was asked of it, so keep going until everything is out or a real error occurs
+	inline bool WriteAllToFile(int fd, const char* data, size_t size) {
+		while( size != 0 ) {
+				auto written { ::write(fd, data, size) };
+				if( written < 0 ) {
+						if( errno == EINTR ) continue;
+						return false;
+				}
+				data += written;
+				size -= static_cast<size_t>(written);
+			}
+		return true;
+	}
+
+	inline int OpenSinkFile(std::string_view path) {
+		std::string filePath { path };
+		return ::open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	}
+
+}    // namespace formatter::sinks::sink_helper
+
+/************************************************************************ MappedFileSink ************************************************************************/
+inline formatter::sinks::MappedFileSink::MappedFileSink(std::string_view path, size_t growthSize)
+	: fd(-1), mapping(nullptr), mappedSize(0), writePos(0), growthChunk(sink_helper::RoundToPageSize(growthSize)), errHandle() {
+	std::string filePath { path };
+	fd = ::open(filePath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if( fd == -1 ) {
+			errHandle.ReportError(af_errors::ErrorType::sink_open_failed);
+		}
+#if !defined(AF_NO_EXCEPTIONS)
+	// the destructor doesn't run for a constructor that throws, so the file has to be closed here if it can't be mapped
+	try {
+			Grow(growthChunk);
+	} catch( ... ) {
+			::close(fd);
+			fd = -1;
+			throw;
+		}
+#else
+	Grow(growthChunk);
+#endif
+}
+
+inline formatter::sinks::MappedFileSink::MappedFileSink(MappedFileSink&& other) noexcept
+	: fd(std::exchange(other.fd, -1)), mapping(std::exchange(other.mapping, nullptr)), mappedSize(std::exchange(other.mappedSize, 0)),
+	  writePos(std::exchange(other.writePos, 0)), growthChunk(other.growthChunk), errHandle() { }
+
+inline formatter::sinks::MappedFileSink& formatter::sinks::MappedFileSink::operator=(MappedFileSink&& other) noexcept {
+	if( this != &other ) {
+			Release();
+			fd          = std::exchange(other.fd, -1);
+			mapping     = std::exchange(other.mapping, nullptr);
+			mappedSize  = std::exchange(other.mappedSize, 0);
+			writePos    = std::exchange(other.writePos, 0);
+			growthChunk = other.growthChunk;
+		}
+	return *this;
+}
+
+inline formatter::sinks::MappedFileSink::~MappedFileSink() {
+	Release();
+}
+
+inline void formatter::sinks::MappedFileSink::append(const char* data, size_t size) {
+	if( writePos + size > mappedSize ) Grow(writePos + size);
+	std::memcpy(mapping + writePos, data, size);
+	writePos += size;
+}
+
+inline void formatter::sinks::MappedFileSink::push_back(char ch) {
+	if( writePos == mappedSize ) Grow(writePos + 1);
+	mapping[ writePos++ ] = ch;
+}
+
+inline void formatter::sinks::MappedFileSink::Reserve(size_t size) {
+	if( writePos + size > mappedSize ) Grow(writePos + size);
+}
+
+inline size_t formatter::sinks::MappedFileSink::size() const {
+	return writePos;
+}
+
+inline bool formatter::sinks::MappedFileSink::IsOpen() const {
+	return fd != -1;
+}
+
+// Grows the file and the mapping to at least 'required' bytes, rounded up to the next multiple of the growth chunk so that remapping stays a rare event
+// rather than tracking the write position byte by byte.
+inline void formatter::sinks::MappedFileSink::Grow(size_t required) {
+	if( fd == -1 ) errHandle.ReportError(af_errors::ErrorType::sink_write_failed);
+	size_t newSize { ((required + growthChunk - 1) / growthChunk) * growthChunk };
+	if( ::ftruncate(fd, static_cast<off_t>(newSize)) != 0 ) {
+			errHandle.ReportError(af_errors::ErrorType::sink_map_failed);
+		}
+	void* newMapping { MAP_FAILED };
+	if( mapping == nullptr ) {
+			newMapping = ::mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	} else {
+#if defined(__linux__)
+			newMapping = ::mremap(mapping, mappedSize, newSize, MREMAP_MAYMOVE);
+#else
+			::munmap(mapping, mappedSize);
+			mapping    = nullptr;
+			mappedSize = 0;
+			newMapping = ::mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+#endif
+		}
+	// a failed mremap() leaves the old mapping in place, so it's kept (and later unmapped by Close() or Release()) rather than leaked
+	if( newMapping == MAP_FAILED ) {
+			errHandle.ReportError(af_errors::ErrorType::sink_map_failed);
+		}
+	mapping    = static_cast<char*>(newMapping);
+	mappedSize = newSize;
+}
+
+inline void formatter::sinks::MappedFileSink::Close() {
+	if( fd == -1 ) return;
+	bool failed { false };
+	if( mapping != nullptr ) {
+			failed |= ::munmap(mapping, mappedSize) != 0;
+		}
+	failed |= ::ftruncate(fd, static_cast<off_t>(writePos)) != 0;
+	failed |= ::close(fd) != 0;
+	fd         = -1;
+	mapping    = nullptr;
+	mappedSize = 0;
+	if( failed ) errHandle.ReportError(af_errors::ErrorType::sink_write_failed);
+}
+
+// Non-throwing version of Close() for the destructor and move-assignment paths
+inline void formatter::sinks::MappedFileSink::Release() noexcept {
+	if( fd == -1 ) return;
+	if( mapping != nullptr ) ::munmap(mapping, mappedSize);
+	[[maybe_unused]] auto truncated { ::ftruncate(fd, static_cast<off_t>(writePos)) };
+	::close(fd);
+	fd         = -1;
+	mapping    = nullptr;
+	mappedSize = 0;
+}
+
+/*************************************************************************** FileSink ***************************************************************************/
+inline formatter::sinks::FileSink::FileSink(std::string_view path, size_t bufferSize)
+	: fd(sink_helper::OpenSinkFile(path)), buffer(bufferSize == 0 ? 1 : bufferSize), bufferPos(0), totalWritten(0), errHandle() {
+	if( fd == -1 ) {
+			errHandle.ReportError(af_errors::ErrorType::sink_open_failed);
+		}
+}
+
+inline formatter::sinks::FileSink::~FileSink() {
+	if( fd == -1 ) return;
+	[[maybe_unused]] auto written { sink_helper::WriteAllToFile(fd, buffer.data(), bufferPos) };
+	::close(fd);
+}
+
+inline void formatter::sinks::FileSink::append(const char* data, size_t size) {
+	if( bufferPos + size > buffer.size() ) {
+			Flush();
+			// anything that wouldn't fit in an empty buffer anyway is written straight through
+			if( size >= buffer.size() ) {
+					if( !sink_helper::WriteAllToFile(fd, data, size) ) errHandle.ReportError(af_errors::ErrorType::sink_write_failed);
+					totalWritten += size;
+					return;
+			}
+		}
+	std::memcpy(buffer.data() + bufferPos, data, size);
+	bufferPos += size;
+}
+
+inline void formatter::sinks::FileSink::push_back(char ch) {
+	if( bufferPos == buffer.size() ) Flush();
+	buffer[ bufferPos++ ] = ch;
+}
+
+inline void formatter::sinks::FileSink::Flush() {
+	if( bufferPos == 0 ) return;
+	if( fd == -1 || !sink_helper::WriteAllToFile(fd, buffer.data(), bufferPos) ) {
+			errHandle.ReportError(af_errors::ErrorType::sink_write_failed);
+		}
+	totalWritten += bufferPos;
+	bufferPos = 0;
+}
+
+inline void formatter::sinks::FileSink::Close() {
+	if( fd == -1 ) return;
+	Flush();
+	auto closed { ::close(fd) == 0 };
+	fd = -1;
+	if( !closed ) errHandle.ReportError(af_errors::ErrorType::sink_write_failed);
+}
+
+inline size_t formatter::sinks::FileSink::size() const {
+	return totalWritten + bufferPos;
+}
+
+/************************************************************************* AsyncFileSink ************************************************************************/
+inline formatter::sinks::AsyncFileSink::AsyncFileSink(std::string_view path, size_t bufferSize, Backpressure backpressure)
+	: fd(sink_helper::OpenSinkFile(path)), policy(backpressure), front(bufferSize == 0 ? 1 : bufferSize), back(bufferSize == 0 ? 1 : bufferSize), frontPos(0),
+	  committedPos(0), backSize(0), droppedMessages(0), droppingMessage(false), holdsFront(false), state(writer_idle), writeFailed(false), writer(),
+	  errHandle() {
+	if( fd == -1 ) {
+			// the error callback used with AF_NO_EXCEPTIONS may leave some other way than returning, so the writer isn't started on fd -1 regardless
+			errHandle.ReportError(af_errors::ErrorType::sink_open_failed);
+			return;
+		}
+#if !defined(AF_NO_EXCEPTIONS)
+	// the destructor doesn't run for a constructor that throws, so the file has to be closed here if the writer thread can't be started
+	try {
+			writer = std::thread(&AsyncFileSink::WriterLoop, this);
+	} catch( ... ) {
+			::close(fd);
+			fd = -1;
+			throw;
+		}
+#else
+	writer = std::thread(&AsyncFileSink::WriterLoop, this);
+#endif
+}
+
+inline formatter::sinks::AsyncFileSink::~AsyncFileSink() {
+	if( fd == -1 ) return;
+	AcquireFront();
+	if( !droppingMessage ) committedPos = frontPos;
+	DrainFront();
+	state.store(writer_shutdown, std::memory_order_release);
+	state.notify_all();
+	writer.join();
+	::close(fd);
+}
+
+inline void formatter::sinks::AsyncFileSink::append(const char* data, size_t size) {
+	if( !holdsFront ) AcquireFront();
+	if( frontPos + size > front.size() ) MakeRoom(size);
+	if( droppingMessage ) return;
+	std::memcpy(front.data() + frontPos, data, size);
+	frontPos += size;
+}
+
+inline void formatter::sinks::AsyncFileSink::push_back(char ch) {
+	if( !holdsFront ) AcquireFront();
+	if( frontPos == front.size() ) MakeRoom(1);
+	if( droppingMessage ) return;
+	front[ frontPos++ ] = ch;
+}
+
+inline void formatter::sinks::AsyncFileSink::Commit() {
+	AcquireFront();
+	if( droppingMessage ) {
+			droppingMessage = false;
+			frontPos        = committedPos;
+	} else {
+			committedPos = frontPos;
+			TryHandoff();
+		}
+	ReleaseFront();
+	if( writeFailed.load(std::memory_order_relaxed) ) errHandle.ReportError(af_errors::ErrorType::sink_write_failed);
+}
+
+inline void formatter::sinks::AsyncFileSink::Flush() {
+	AcquireFront();
+	DrainFront();
+	ReleaseFront();
+	if( writeFailed.load(std::memory_order_relaxed) ) errHandle.ReportError(af_errors::ErrorType::sink_write_failed);
+}
+
+inline void formatter::sinks::AsyncFileSink::Close() {
+	if( fd == -1 ) return;
+	AcquireFront();
+	// anything left over that wasn't committed is still treated as a complete message on close
+	if( !droppingMessage ) committedPos = frontPos;
+	DrainFront();
+	state.store(writer_shutdown, std::memory_order_release);
+	state.notify_all();
+	writer.join();
+	auto closed { ::close(fd) == 0 };
+	fd = -1;
+	if( writeFailed.load(std::memory_order_relaxed) || !closed ) errHandle.ReportError(af_errors::ErrorType::sink_write_failed);
+}
+
+inline size_t formatter::sinks::AsyncFileSink::DroppedCount() const {
+	return droppedMessages;
+}
+
+// Takes ownership of the active buffer for the formatting thread. It's held from the first write of a message until Commit(), so the only time this
+// has to wait is while the writer thread is swapping in committed messages that it picked up on its own.
+inline void formatter::sinks::AsyncFileSink::AcquireFront() {
+	if( holdsFront ) return;
+	for( auto current { state.load(std::memory_order_relaxed) };; ) {
+			if( current & front_owned ) {
+					state.wait(current, std::memory_order_relaxed);
+					current = state.load(std::memory_order_relaxed);
+			} else if( state.compare_exchange_weak(current, current | front_owned, std::memory_order_acquire, std::memory_order_relaxed) ) {
+					break;
+				}
+		}
+	holdsFront = true;
+}
+
+// Gives the active buffer back, flagging any committed messages that couldn't be handed off so that the writer picks them up when it's done
+inline void formatter::sinks::AsyncFileSink::ReleaseFront() {
+	holdsFront = false;
+	auto waiting { committedPos != 0 ? static_cast<unsigned int>(handoff_waiting) : 0u };
+	auto current { state.load(std::memory_order_relaxed) };
+	while( !state.compare_exchange_weak(current, (current & ~(front_owned | handoff_waiting)) | waiting, std::memory_order_release,
+	                                    std::memory_order_relaxed) ) {
+		}
+	if( waiting != 0 ) state.notify_all();
+}
+
+// Called when the active buffer can't hold 'size' more bytes. The committed messages are handed off if the writer is idle; otherwise the backpressure
+// policy decides whether to wait on the writer, drop the message being formatted, or grow the active buffer.
+inline void formatter::sinks::AsyncFileSink::MakeRoom(size_t size) {
+	if( droppingMessage ) return;
+	if( committedPos != 0 && !TryHandoff() ) {
+			switch( policy ) {
+					case Backpressure::Block:
+						WaitForWriter();
+						TryHandoff();
+						break;
+					case Backpressure::Drop:
+						droppingMessage = true;
+						frontPos        = committedPos;
+						++droppedMessages;
+						return;
+					case Backpressure::Grow: break;
+				}
+		}
+	// Whatever is left is either a single message larger than the buffer or the backlog under the Grow policy
+	if( frontPos + size > front.size() ) {
+			front.resize(std::max(front.size() * 2, frontPos + size));
+		}
+}
+
+// Swaps the active buffer with the writer's, carrying over any partially formatted message to the new active buffer. Only called by whichever
+// thread owns the active buffer while the writer is idle.
+inline void formatter::sinks::AsyncFileSink::SwapBuffers() {
+	std::swap(front, back);
+	backSize = committedPos;
+	auto tail { frontPos - committedPos };
+	if( front.size() < tail ) front.resize(tail);
+	std::memcpy(front.data(), back.data() + committedPos, tail);
+	frontPos     = tail;
+	committedPos = 0;
+}
+
+inline bool formatter::sinks::AsyncFileSink::TryHandoff() {
+	if( committedPos == 0 || (state.load(std::memory_order_acquire) & writer_mask) != writer_idle ) return false;
+	SwapBuffers();
+	// the formatting thread owns the active buffer here, so the writer can't be changing the state other than by waiting on it
+	state.store(writer_pending | front_owned, std::memory_order_release);
+	state.notify_all();
+	return true;
+}
+
+inline void formatter::sinks::AsyncFileSink::WaitForWriter() {
+	for( auto current { state.load(std::memory_order_acquire) }; (current & writer_mask) == writer_pending; current = state.load(std::memory_order_acquire) ) {
+			state.wait(current, std::memory_order_acquire);
+		}
+}
+
+// Hands off everything committed and waits until it's been written. The caller owns the active buffer.
+inline void formatter::sinks::AsyncFileSink::DrainFront() {
+	WaitForWriter();
+	if( committedPos != 0 ) {
+			TryHandoff();
+			WaitForWriter();
+		}
+}
+
+inline void formatter::sinks::AsyncFileSink::WriterLoop() {
+	for( ;; ) {
+			auto current { state.load(std::memory_order_acquire) };
+			if( (current & writer_mask) == writer_shutdown ) return;
+			if( (current & writer_mask) == writer_pending ) {
+					if( !sink_helper::WriteAllToFile(fd, back.data(), backSize) ) writeFailed.store(true, std::memory_order_relaxed);
+					state.fetch_and(~static_cast<unsigned int>(writer_mask), std::memory_order_acq_rel);
+					state.notify_all();
+					continue;
+			}
+			// Messages were committed while the last write was in flight. If the formatting thread is between messages, take the active buffer and
+			// swap them in here rather than leaving them until its next call into the sink, which may never come.
+			if( (current & handoff_waiting) && !(current & front_owned) ) {
+					if( state.compare_exchange_strong(current, current | front_owned, std::memory_order_acquire, std::memory_order_relaxed) ) {
+							auto pending { committedPos != 0 };
+							if( pending ) SwapBuffers();
+							state.store(pending ? writer_pending : writer_idle, std::memory_order_release);
+							state.notify_all();
+					}
+					continue;
+			}
+			state.wait(current, std::memory_order_acquire);
+		}
+}
+
+/*********************************************************************** ScatterGatherSink **********************************************************************/
+inline formatter::sinks::ScatterGatherSink::ScatterGatherSink(size_t referenceThreshold)
+	: segments(), arena(), ioVecs(), totalSize(0), threshold(referenceThreshold), errHandle() { }
+
+inline void formatter::sinks::ScatterGatherSink::append(const char* data, size_t size) {
+	if( size == 0 ) return;
+	auto offset { arena.size() };
+	arena.insert(arena.end(), data, data + size);
+	totalSize += size;
+	// extend the previous segment instead of adding a new one if it's the arena segment that ends right where this one starts
+	if( !segments.empty() ) {
+			if( auto& last { segments.back() }; last.data == nullptr && last.offset + last.size == offset ) {
+					last.size += size;
+					return;
+			}
+		}
+	segments.push_back(Segment { nullptr, offset, size });
+}
+
+inline void formatter::sinks::ScatterGatherSink::append_ref(const char* data, size_t size) {
+	if( size < threshold ) return append(data, size);
+	totalSize += size;
+	if( !segments.empty() ) {
+			if( auto& last { segments.back() }; last.data != nullptr && last.data + last.size == data ) {
+					last.size += size;
+					return;
+			}
+		}
+	segments.push_back(Segment { data, 0, size });
+}
+
+inline void formatter::sinks::ScatterGatherSink::push_back(char ch) {
+	append(&ch, 1);
+}
+
+inline size_t formatter::sinks::ScatterGatherSink::size() const {
+	return totalSize;
+}
+
+inline std::span<const iovec> formatter::sinks::ScatterGatherSink::IoVecs() {
+	ioVecs.resize(segments.size());
+	for( size_t i { 0 }; i < segments.size(); ++i ) {
+			const auto& segment { segments[ i ] };
+			auto base { segment.data != nullptr ? segment.data : arena.data() + segment.offset };
+			ioVecs[ i ] = iovec { const_cast<char*>(base), segment.size };
+		}
+	return ioVecs;
+}
+
+inline void formatter::sinks::ScatterGatherSink::Clear() {
+	segments.clear();
+	arena.clear();
+	totalSize = 0;
+}
+
+// writev() is limited to IOV_MAX entries per call and may stop partway through any of them, so the list is written in batches and the current
+// entry is adjusted in place after a partial write
+inline void formatter::sinks::ScatterGatherSink::WriteTo(int fd) {
+	IoVecs();
+	static const size_t maxIoVecs { [] {
+		auto limit { ::sysconf(_SC_IOV_MAX) };
+		return limit > 0 ? static_cast<size_t>(limit) : size_t { 16 };
+	}() };
+	size_t index { 0 };
+	while( index < ioVecs.size() ) {
+			auto count { std::min(maxIoVecs, ioVecs.size() - index) };
+			auto written { ::writev(fd, ioVecs.data() + index, static_cast<int>(count)) };
+			if( written < 0 ) {
+					if( errno == EINTR ) continue;
+					errHandle.ReportError(af_errors::ErrorType::sink_write_failed);
+			}
+			auto remaining { static_cast<size_t>(written) };
+			while( index < ioVecs.size() && remaining >= ioVecs[ index ].iov_len ) {
+					remaining -= ioVecs[ index ].iov_len;
+					++index;
+				}
+			if( remaining != 0 ) {
+					ioVecs[ index ].iov_base = static_cast<char*>(ioVecs[ index ].iov_base) + remaining;
+					ioVecs[ index ].iov_len -= remaining;
+			}
+		}
+}
+
+#endif    // !_WIN32
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/*********************************************************************************************************************************************************
+ * Code point classification for the text-aware specs. The tables are compact sorted lists of inclusive code point ranges that are binary searched. The
+ * debug escaping and Grapheme_Extend tables are generated from the Unicode 14.0 UCD, so they match what std::format escapes; the width tables only
+ * list the East Asian Wide and zero width blocks std::format estimates width with. Every lookup is only reached for non-ASCII text, as the callers
+ * handle ASCII themselves.
+ *********************************************************************************************************************************************************/
+namespace formatter::unicode {
+
+	struct CodePointRange
+	{
+		char32_t first;
+		char32_t last;
+	};
+
+	// Decodes the UTF-8 sequence at the start of 'sv' into 'codePoint' and returns its length, or 0 if the sequence is ill-formed (overlong, a surrogate,
+	// out of range or truncated)
+	constexpr size_t DecodeUtf8(std::string_view sv, char32_t& codePoint);
+	// Encodes 'codePoint' as UTF-8 into 'dest', which must have room for 4 bytes, and returns the length written; surrogates and out of range values
+	// are written as U+FFFD
+	constexpr size_t EncodeUtf8(char32_t codePoint, char* dest);
+	// Whether the debug ('?') spec writes the code point as an escape sequence: separators other than ' ', control and format characters, surrogates,
+	// private use characters and unassigned code points (noncharacters included)
+	constexpr bool IsDebugEscaped(char32_t codePoint);
+	// Whether the code point has the Grapheme_Extend property (combining marks, variation selectors, etc...)
+	constexpr bool IsGraphemeExtend(char32_t codePoint);
+	// The number of columns the code point takes up when displayed: 0 for Grapheme_Extend and zero width characters, 2 for East Asian Wide and
+	// Fullwidth characters (the same ranges std::format estimates width with) and 1 for everything else
+	constexpr size_t CodePointWidth(char32_t codePoint);
+
+	struct ColumnSpan
+	{
+		size_t bytes;
+		size_t columns;
+	};
+	// Measures the longest prefix of 'sv' that fits in 'maxColumns' display columns without splitting a code point; each byte of ill-formed UTF-8 is
+	// counted as one column
+	constexpr ColumnSpan MeasureColumns(std::string_view sv, size_t maxColumns);
+
+	namespace unicode_helper {
+		template<size_t N> constexpr bool IsSortedRanges(const std::array<CodePointRange, N>& ranges);
+		template<size_t N> constexpr bool InRanges(const std::array<CodePointRange, N>& ranges, char32_t codePoint);
+	}    // namespace unicode_helper
+
+}    // namespace formatter::unicode
+
+#include "ArgUnicodeImpl.h"
@@ -0,0 +1,92 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgFormatter.h"
+
+TEST_CASE("Alignment: Padding Is Written Around The Value In Place") {
+	REQUIRE(formatter::format("[{:*<6}]", 42) == "[42****]");
+	REQUIRE(formatter::format("[{:*>6}]", 42) == "[****42]");
+	REQUIRE(formatter::format("[{:*^7}]", 42) == "[**42***]");
+	REQUIRE(formatter::format("[{:6}]", 42) == "[    42]");
+	REQUIRE(formatter::format("[{:*^7}]", std::string_view { "abc" }) == "[**abc**]");
+	REQUIRE(formatter::format("[{:*<2}]", 12345) == "[12345]");
+	// appending to a container that already holds text
+	std::string out { "prefix:" };
+	formatter::format_to(std::back_inserter(out), "{:-^9}|{:.>5}", std::string_view { "mid" }, 1.5);
+	REQUIRE(out == "prefix:---mid---|..1.5");
+}
+
+TEST_CASE("Alignment: A Field Without An Argument Is Only Padding") {
+	REQUIRE(formatter::format("{:*5}") == "*****");
+	REQUIRE(formatter::format("a{:-3}b") == "a---b");
+	REQUIRE(formatter::format("{:=600}") == std::string(600, '='));
+}
+
+TEST_CASE("Alignment: Fields Wider Than The Fill Buffer") {
+	for( int width: { 255, 256, 257, 1000, 4096 } ) {
+			auto padded { "{:_>" + std::to_string(width) + "}" };
+			auto centered { "{:_^" + std::to_string(width) + "}" };
+			auto expected { std::string(static_cast<size_t>(width) - 2, '_') + "42" };
+			REQUIRE(formatter::format(std::string_view(padded), 42) == expected);
+			auto half { (static_cast<size_t>(width) - 3) / 2 };
+			REQUIRE(formatter::format(std::string_view(centered), std::string_view { "abc" }) ==
+			        std::string(half, '_') + "abc" + std::string(static_cast<size_t>(width) - 3 - half, '_'));
+			// the containers that don't take their padding in place are written in blocks from the fill buffer
+			std::vector<char> asVector;
+			formatter::format_to(std::back_inserter(asVector), std::string_view(padded), 42);
+			REQUIRE(std::string(asVector.begin(), asVector.end()) == expected);
+			std::u16string wide;
+			formatter::format_to(std::back_inserter(wide), std::string_view(padded), 42);
+			REQUIRE(wide == std::u16string(expected.begin(), expected.end()));
+		}
+}
+
+TEST_CASE("Alignment: The Alignment Can Be Given Without A Fill") {
+	REQUIRE(formatter::format("[{:>8}]", 12) == "[      12]");
+	REQUIRE(formatter::format("[{:<8}]", 12) == "[12      ]");
+	REQUIRE(formatter::format("[{:^8}]", std::string_view { "ab" }) == "[   ab   ]");
+	REQUIRE(formatter::format("[{:>8}]", std::string_view { "ab" }) == "[      ab]");
+	REQUIRE(formatter::format("[{:>8.2f}]", 1.5) == "[    1.50]");
+	REQUIRE(formatter::format("[{:<}]", 12) == "[12]");
+}
+
+TEST_CASE("Alignment: Any Single Code Point Can Be The Fill") {
+	REQUIRE(formatter::format("[{:\xE2\x94\x80^9}]", std::string_view { "ab" }) == "[\xE2\x94\x80\xE2\x94\x80\xE2\x94\x80" "ab" "\xE2\x94\x80\xE2\x94\x80\xE2\x94\x80\xE2\x94\x80]");
+	REQUIRE(formatter::format("[{:\xC2\xB7<6}]", 12) == "[12\xC2\xB7\xC2\xB7\xC2\xB7\xC2\xB7]");
+	REQUIRE(formatter::format("[{:\xF0\x9F\x98\x80>3}]", 1) == "[\xF0\x9F\x98\x80\xF0\x9F\x98\x80" "1]");
+	REQUIRE(formatter::format("{:\xE2\x96\x88" "4}") == "\xE2\x96\x88\xE2\x96\x88\xE2\x96\x88\xE2\x96\x88");
+	// the alignment is looked for after the whole fill sequence rather than its first byte
+	REQUIRE(formatter::format("[{:\xE2\x94\x80>5}]", 'x') == "[\xE2\x94\x80\xE2\x94\x80\xE2\x94\x80\xE2\x94\x80x]");
+	REQUIRE_THROWS(formatter::format("[{:{<5}]", 1));
+}
+
+TEST_CASE("Alignment: The Fill Has To Be One Well-Formed Code Point") {
+	using formatter::af_errors::ErrorType;
+	// a stray continuation byte, a lead byte without its continuation, a surrogate, an overlong '/' and a value past U+10FFFF
+	for( std::string_view fill: { "\xFF", "\x80", "\xC3", "\xE2\x94", "\xED\xA0\x80", "\xC0\xAF", "\xF4\x90\x80\x80" } ) {
+			auto fmt { "[{:" + std::string(fill) + "<5}]" };
+			REQUIRE_THROWS_AS(formatter::format(std::string_view(fmt), 1), formatter::af_errors::error_handler::format_error);
+			std::string out;
+			REQUIRE(formatter::try_format_to(std::back_inserter(out), std::string_view(fmt), 1).error() == ErrorType::invalid_fill_character);
+			REQUIRE(out.empty());
+		}
+	REQUIRE_THROWS_AS(formatter::format("{:\xFF" "4}"), formatter::af_errors::error_handler::format_error);
+	REQUIRE(formatter::format("[{:\xC3\xA9<5}]", 1) == "[1\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9]");
+}
+
+TEST_CASE("Alignment: Wide Multi-Byte Fills Match Repeating The Fill") {
+	constexpr std::string_view rule { "\xE2\x94\x80" };
+	for( int width: { 1, 2, 3, 85, 86, 87, 256, 1000, 4096 } ) {
+			std::string expected;
+			for( int i { 0 }; i < width - 1; ++i ) expected += rule;
+			expected += "x";
+			auto fmt { "{:\xE2\x94\x80>" + std::to_string(width) + "}" };
+			REQUIRE(formatter::format(std::string_view(fmt), 'x') == expected);
+			std::vector<char> asVector;
+			formatter::format_to(std::back_inserter(asVector), std::string_view(fmt), 'x');
+			REQUIRE(std::string(asVector.begin(), asVector.end()) == expected);
+			// the fill buffer is only ever written out in whole fill characters
+			std::u16string wide;
+			formatter::format_to(std::back_inserter(wide), std::string_view(fmt), 'x');
+			REQUIRE(wide == std::u16string(static_cast<size_t>(width) - 1, u'\x2500') + u"x");
+		}
+}
@@ -0,0 +1,112 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+	std::atomic<bool> countAllocations { false };
+	std::atomic<size_t> allocationCount { 0 };
+
+	void* Allocate(size_t size) noexcept {
+		if( countAllocations.load(std::memory_order_relaxed) ) allocationCount.fetch_add(1, std::memory_order_relaxed);
+		return std::malloc(size != 0 ? size : 1);
+	}
+
+	void* AllocateAligned(size_t size, std::align_val_t align) noexcept {
+		if( countAllocations.load(std::memory_order_relaxed) ) allocationCount.fetch_add(1, std::memory_order_relaxed);
+		auto alignment { static_cast<size_t>(align) };
+#if defined(_WIN32)
+		return _aligned_malloc(size != 0 ? size : 1, alignment);
+#else
+		// aligned_alloc() wants the size to be a multiple of the alignment
+		return std::aligned_alloc(alignment, ((size + alignment - 1) / alignment) * alignment + (size == 0 ? alignment : 0));
+#endif
+	}
+
+	void FreeAligned(void* ptr) noexcept {
+#if defined(_WIN32)
+		_aligned_free(ptr);
+#else
+		std::free(ptr);
+#endif
+	}
+
+}    // namespace
+
+void af_test::StartCountingAllocations() {
+	allocationCount.store(0, std::memory_order_relaxed);
+	countAllocations.store(true, std::memory_order_relaxed);
+}
+
+size_t af_test::StopCountingAllocations() {
+	countAllocations.store(false, std::memory_order_relaxed);
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+void* operator new(size_t size) {
+	if( auto ptr { Allocate(size) } ) return ptr;
+	throw std::bad_alloc();
+}
+void* operator new[](size_t size) {
+	if( auto ptr { Allocate(size) } ) return ptr;
+	throw std::bad_alloc();
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+	return Allocate(size);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+	return Allocate(size);
+}
+void* operator new(size_t size, std::align_val_t align) {
+	if( auto ptr { AllocateAligned(size, align) } ) return ptr;
+	throw std::bad_alloc();
+}
+void* operator new[](size_t size, std::align_val_t align) {
+	if( auto ptr { AllocateAligned(size, align) } ) return ptr;
+	throw std::bad_alloc();
+}
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+	return AllocateAligned(size, align);
+}
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+	return AllocateAligned(size, align);
+}
+
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+void operator delete[](void* ptr) noexcept {
+	std::free(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept {
+	std::free(ptr);
+}
+void operator delete[](void* ptr, size_t) noexcept {
+	std::free(ptr);
+}
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+	std::free(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+	std::free(ptr);
+}
+void operator delete(void* ptr, std::align_val_t) noexcept {
+	FreeAligned(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+	FreeAligned(ptr);
+}
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+	FreeAligned(ptr);
+}
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept {
+	FreeAligned(ptr);
+}
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+	FreeAligned(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+	FreeAligned(ptr);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+
+// Every form of the global operator new and delete is replaced in AllocationCounter.cpp. The replacements apply to the whole test binary but only count
+// between these two calls, so tests can check that a path formats without allocating. They're kept in their own translation unit so that the compiler
+// can't inline them into the new-expressions of the code being tested.
+namespace af_test {
+
+	void StartCountingAllocations();
+	// Stops counting and returns how many allocations were made since StartCountingAllocations()
+	size_t StopCountingAllocations();
+
+}    // namespace af_test
@@ -0,0 +1,142 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgBatch.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace formatter::arg_formatter;
+
+using Row = std::tuple<size_t, std::string, double, bool>;
+
+static std::vector<Row> MakeRows(size_t count) {
+	std::vector<Row> rows;
+	rows.reserve(count);
+	for( size_t i { 0 }; i < count; ++i ) {
+			rows.emplace_back(i, std::string(i % 17, 'r'), static_cast<double>(i) * 0.125, i % 3 == 0);
+		}
+	return rows;
+}
+
+static std::string FormatRowByRow(std::string_view fmt, const std::vector<Row>& rows) {
+	ArgFormatter formatter;
+	std::string expected;
+	for( auto& [ id, label, value, flag ]: rows ) formatter.format_to(std::back_inserter(expected), fmt, id, label, value, flag);
+	return expected;
+}
+
+TEST_CASE("Parse-Once Row Formatting Matches Per-Call Formatting") {
+	ArgFormatter formatter;
+	std::tm time {};
+	time.tm_year = 125;
+	time.tm_mon  = 6;
+	time.tm_mday = 4;
+	time.tm_hour = 13;
+	std::vector<std::tuple<int, std::string, double, std::tm, int>> rows;
+	for( int i { 0 }; i < 300; ++i ) {
+			time.tm_min = i % 60;
+			rows.emplace_back(i - 150, std::string(static_cast<size_t>(i % 7), 's'), i * 1.75, time, i % 9 + 1);
+		}
+	for( std::string_view fmt: { "{}", "plain text only", "{},{},{},{:%H:%M},{}\n", "[{0:_>8}|{1:*^10}|{2:+.2e}|{3}] {4}\n",
+	                             "{:#x} {:.3} {:{}.3f} {:%Y-%m-%d %H:%M}\n", "{4} {0:b} {1} {2:g}" } )
+		{
+			std::string expected;
+			for( auto& [ a, b, c, d, e ]: rows ) {
+					std::string_view view { fmt };
+					// the nested width form takes its value from the argument after the one it's for
+					if( view.starts_with("{:#x}") ) {
+							formatter.format_to(std::back_inserter(expected), fmt, a, b, c, e, d);
+					} else {
+							formatter.format_to(std::back_inserter(expected), fmt, a, b, c, d, e);
+						}
+				}
+			std::string batch;
+			if( fmt.starts_with("{:#x}") ) {
+					std::vector<std::tuple<int, std::string, double, int, std::tm>> reordered;
+					for( auto& [ a, b, c, d, e ]: rows ) reordered.emplace_back(a, b, c, e, d);
+					formatter.format_rows_to(std::back_inserter(batch), fmt, reordered);
+			} else {
+					formatter.format_rows_to(std::back_inserter(batch), fmt, rows);
+				}
+			REQUIRE(batch == expected);
+		}
+}
+
+TEST_CASE("Parse-Once Column Formatting Matches Per-Call Formatting") {
+	ArgFormatter formatter;
+	std::vector<size_t> ids { 1, 22, 333, 4444, 55555 };
+	std::vector<std::string_view> names { "one", "two", "three", "four", "five" };
+	std::array<double, 6> values { 0.5, 1.25, -2.75, 1e10, 3.14159, 99.0 };
+	std::string expected;
+	for( size_t i { 0 }; i < ids.size(); ++i ) formatter.format_to(std::back_inserter(expected), "{:_>6}|{:_<6}|{:.2f}\n", ids[ i ], names[ i ], values[ i ]);
+	std::string batch { "header\n" };
+	// the shortest column decides how many rows there are
+	formatter.format_columns_to(std::back_inserter(batch), "{:_>6}|{:_<6}|{:.2f}\n", ids, names, values);
+	REQUIRE(batch == "header\n" + expected);
+}
+
+TEST_CASE("Batch Formatting Matches Row By Row Formatting") {
+	static constexpr std::string_view fmt { "{},{},{:.3f},{}\n" };
+	// enough rows that every thread count below actually gets split across workers
+	auto rows { MakeRows(20'000) };
+	auto expected { FormatRowByRow(fmt, rows) };
+	for( size_t threads: { 0, 1, 2, 3, 8 } ) {
+			REQUIRE(formatter::format_batch(fmt, rows, threads) == expected);
+		}
+	REQUIRE(formatter::format_batch(fmt, std::span<const Row>(rows).first(10), 4) == FormatRowByRow(fmt, { rows.begin(), rows.begin() + 10 }));
+	REQUIRE(formatter::format_batch(fmt, std::span<const Row>(), 4).empty());
+
+	std::vector<char> chars { '>' };
+	formatter::format_batch_to(std::back_inserter(chars), fmt, rows, 4);
+	REQUIRE(std::string_view(chars.data(), chars.size()) == ">" + expected);
+}
+
+// Formats itself through the free format_to(), as a CustomFormatter usually does, so every worker makes nested calls of its own
+struct BatchPoint
+{
+	int x;
+	int y;
+};
+template<> struct formatter::CustomFormatter<BatchPoint>
+{
+	constexpr void Parse(std::string_view) { }
+	template<typename resultCtx> constexpr auto Format(const BatchPoint& point, resultCtx& ctx) const {
+		formatter::format_to(std::back_inserter(ctx), "({}, {})", point.x, point.y);
+	}
+};
+
+TEST_CASE("Batch Formatting Custom Types Across Worker Threads") {
+	static constexpr std::string_view fmt { "{} {}\n" };
+	std::vector<std::tuple<int, BatchPoint>> rows;
+	for( int i { 0 }; i < 20'000; ++i ) rows.emplace_back(i, BatchPoint { i, -i });
+	std::string expected;
+	for( auto& [ id, point ]: rows ) formatter::format_to(std::back_inserter(expected), fmt, id, point);
+	for( int run { 0 }; run < 5; ++run ) {
+			REQUIRE(formatter::format_batch(fmt, rows, 4) == expected);
+		}
+}
+
+TEST_CASE("Batch Formatting Rethrows Worker Errors") {
+	auto rows { MakeRows(8'192) };
+	REQUIRE_THROWS(formatter::format_batch("{},{},{:.3f},{:q}\n", rows, 4));
+}
+
+#if !defined(_WIN32)
+TEST_CASE("Batch Formatting Writes Chunks With Writev") {
+	static constexpr std::string_view fmt { "{} {} {:.1f} {}\n" };
+	auto rows { MakeRows(10'000) };
+	auto path { std::filesystem::temp_directory_path() / "af_batch_writev_test.txt" };
+	auto fd { ::open(path.string().c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) };
+	REQUIRE(fd != -1);
+	auto written { formatter::format_batch_write(fd, fmt, rows, 4) };
+	::close(fd);
+	auto expected { FormatRowByRow(fmt, rows) };
+	REQUIRE(written == expected.size());
+	std::ifstream file(path, std::ios::binary);
+	std::stringstream contents;
+	contents << file.rdbuf();
+	REQUIRE(contents.str() == expected);
+	file.close();
+	std::filesystem::remove(path);
+}
+#endif
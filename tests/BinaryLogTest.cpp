@@ -0,0 +1,130 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgBinaryLog.h"
+#include <filesystem>
+#include <fstream>
+
+#if !defined(_WIN32)
+
+using namespace formatter::arg_formatter;
+using namespace formatter::binary_log;
+
+static std::filesystem::path TempLogPath(std::string_view name) {
+	return std::filesystem::temp_directory_path() / name;
+}
+
+TEST_CASE("Binary Log Decodes Byte Identical To Direct Formatting") {
+	ArgFormatter formatter;
+	auto path { TempLogPath("af_binary_log_test.afbl") };
+	std::string expected;
+	std::vector<uint64_t> expectedTimestamps;
+	std::tm time {};
+	time.tm_year = 124;
+	time.tm_mon  = 1;
+	time.tm_mday = 29;
+	{
+		BinaryLogWriter writer(path.string());
+		for( int i { 0 }; i < 500; ++i ) {
+				std::string owned(static_cast<size_t>(i % 13), 'q');
+				auto timestamp { static_cast<uint64_t>(i) * 1'000 };
+				writer.WriteAt(timestamp, "[{}] id={:x} value={:.3f} owned={} flag={}\n", "INFO", i, i * 0.5, owned, i % 2 == 0);
+				expected += formatter.format("[{}] id={:x} value={:.3f} owned={} flag={}\n", "INFO", i, i * 0.5, owned, i % 2 == 0);
+				expectedTimestamps.push_back(timestamp);
+				if( i % 50 == 0 ) {
+						writer.WriteAt(timestamp, "{:%Y-%m-%d} {} {} {} {}\n", time, -7ll, 7ull, 'c', 2.5f);
+						expected += formatter.format("{:%Y-%m-%d} {} {} {} {}\n", time, -7ll, 7ull, 'c', 2.5f);
+						expectedTimestamps.push_back(timestamp);
+				}
+			}
+		writer.Close();
+	}
+
+	BinaryLogReader reader(path.string());
+	std::string decoded;
+	REQUIRE(reader.DecodeTo(formatter, decoded) == expectedTimestamps.size());
+	REQUIRE(decoded == expected);
+
+	std::vector<uint64_t> timestamps;
+	reader.ForEachRecord([ & ](uint64_t timestamp, const ArgRecordView&) { timestamps.push_back(timestamp); });
+	REQUIRE(timestamps == expectedTimestamps);
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Binary Log Writes Each Format String Once") {
+	auto path { TempLogPath("af_binary_log_ids.afbl") };
+	std::string_view fmt { "a fairly long format string that should only be stored a single time {}\n" };
+	size_t fileSize { 0 };
+	{
+		BinaryLogWriter writer(path.string());
+		for( int i { 0 }; i < 100; ++i ) writer.Write(fmt, i);
+		writer.Close();
+		fileSize = std::filesystem::file_size(path);
+	}
+	// header + one definition + 100 records of (entry header + one int arg)
+	REQUIRE(fileSize == AF_BINARY_LOG_HEADER_SIZE + (1 + 4 + 4 + fmt.size()) + 100 * (1 + 1 + 4 + 8 + 4 + 1 + sizeof(int)));
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Binary Log Reader Rejects Other Files") {
+	auto path { TempLogPath("af_binary_log_bad.afbl") };
+	{
+		std::ofstream file(path, std::ios::binary);
+		file << "this is a plain text file\n";
+	}
+	REQUIRE_THROWS(BinaryLogReader(path.string()));
+	std::filesystem::remove(path);
+}
+
+// Rewrites the log at 'path' with 'edit' applied to its bytes and checks that replaying it reports the damage instead of reading past a record
+template<typename Edit> static void RequireCorruptLogRejected(const std::filesystem::path& path, const std::string& original, Edit&& edit) {
+	auto bytes { original };
+	edit(bytes);
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	}
+	ArgFormatter formatter;
+	BinaryLogReader reader(path.string());
+	std::string decoded;
+	size_t visited { 0 };
+	REQUIRE_THROWS(reader.ForEachRecord([ & ](uint64_t, const ArgRecordView&) { ++visited; }));
+	REQUIRE(visited == 0);
+	REQUIRE_THROWS(reader.DecodeTo(formatter, decoded));
+}
+
+TEST_CASE("Binary Log Reader Rejects Truncated And Corrupted Records") {
+	auto path { TempLogPath("af_binary_log_corrupt.afbl") };
+	std::string_view fmt { "{} {}\n" };
+	{
+		BinaryLogWriter writer(path.string());
+		writer.Write(fmt, "name", true);
+		writer.Close();
+	}
+	std::string original;
+	{
+		std::ifstream file(path, std::ios::binary);
+		original.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+	// header, then the definition entry, then the record's entry header and its args: [ tag ][ u32 length ][ "name" ][ '\0' ][ tag ][ bool ]
+	auto args { AF_BINARY_LOG_HEADER_SIZE + (1 + 4 + 4 + fmt.size()) + (1 + 1 + 4 + 8 + 4) };
+	auto argsSizeAt { args - 4 };
+	REQUIRE(original.size() == args + 12);
+
+	// the file ends partway through the record
+	RequireCorruptLogRejected(path, original, [](std::string& bytes) { bytes.resize(bytes.size() - 3); });
+	// the entry's args size cuts the string short, so the string's own length runs past the end of the record
+	RequireCorruptLogRejected(path, original, [ & ](std::string& bytes) { bytes[ argsSizeAt ] = 6; });
+	// the entry's args size drops the bool argument entirely
+	RequireCorruptLogRejected(path, original, [ & ](std::string& bytes) { bytes[ argsSizeAt ] = 10; });
+	// a flipped high bit in the string length
+	RequireCorruptLogRejected(path, original, [ & ](std::string& bytes) { bytes[ args + 4 ] ^= 0x80; });
+	// a flipped bit in the string's type tag turns it into a tag that doesn't exist
+	RequireCorruptLogRejected(path, original, [ & ](std::string& bytes) { bytes[ args ] ^= 0x40; });
+	// a bool that's neither 0 nor 1
+	RequireCorruptLogRejected(path, original, [ & ](std::string& bytes) { bytes[ args + 11 ] = 2; });
+	// the string's terminator overwritten
+	RequireCorruptLogRejected(path, original, [ & ](std::string& bytes) { bytes[ args + 9 ] = 'x'; });
+	std::filesystem::remove(path);
+}
+
+#endif
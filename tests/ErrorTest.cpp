@@ -0,0 +1,109 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgFormatter.h"
+
+using formatter::af_errors::ErrorType;
+
+TEST_CASE("Error Codes: Successful Calls Report What They Wrote") {
+	std::string out { "log: " };
+	auto result { formatter::try_format_to(std::back_inserter(out), "{} {:>5} {:.2f}", 42, "ab", 1.5) };
+	REQUIRE(result);
+	REQUIRE(result.has_value());
+	REQUIRE(result.value() == 13);
+	REQUIRE(out == "log: 42    ab 1.50");
+
+	std::vector<char> bytes;
+	REQUIRE(formatter::try_format_to(std::back_inserter(bytes), "{:#x}", 255).value() == 4);
+}
+
+TEST_CASE("Error Codes: Failures Return The Error And Roll Back The Output") {
+	struct ErrorCase
+	{
+		std::string_view format;
+		ErrorType expected;
+	};
+	for( const auto& [ format, expected ]: { ErrorCase { "{} {:q}", ErrorType::invalid_int_spec }, ErrorCase { "{0} {}", ErrorType::position_field_mode },
+	                                        ErrorCase { "{:.3}", ErrorType::invalid_precision_type }, ErrorCase { "text {", ErrorType::missing_bracket } } )
+		{
+			std::string out { "kept" };
+			auto result { formatter::try_format_to(std::back_inserter(out), format, 7, 8) };
+			REQUIRE_FALSE(result);
+			REQUIRE(result.error() == expected);
+			REQUIRE(result.value() == 0);
+			REQUIRE(out == "kept");
+		}
+	std::string out;
+	auto result { formatter::try_format_to(std::back_inserter(out), "{:L}", std::string("x")) };
+	REQUIRE(result.error() == ErrorType::invalid_locale_type);
+	REQUIRE(std::string_view(result.message()) == "Error In Locale Field: Argument Type Cannot Be Localized.");
+}
+
+TEST_CASE("Error Codes: Time, Range And Element Specs Return Their Errors Too") {
+	std::tm time {};
+	std::vector<int> values { 1, 2, 3 };
+	std::string out { "kept" };
+	auto result { formatter::try_format_to(std::back_inserter(out), "{} {:%Eq}", 1, time) };
+	REQUIRE(result.error() == ErrorType::invalid_ctime_spec);
+	result = formatter::try_format_to(std::back_inserter(out), "{:q}", values);
+	REQUIRE(result.error() == ErrorType::invalid_range_spec);
+	result = formatter::try_format_to(std::back_inserter(out), "{::q}", values);
+	REQUIRE(result.error() == ErrorType::invalid_int_spec);
+	result = formatter::try_format_to(std::back_inserter(out), "{:#}", "text");
+	REQUIRE(result.error() == ErrorType::invalid_alt_type);
+	REQUIRE(out == "kept");
+}
+
+struct BadlySpecifiedPoint
+{
+	int x;
+};
+template<> struct formatter::CustomFormatter<BadlySpecifiedPoint>
+{
+	constexpr void Parse(std::string_view) { }
+	template<typename resultCtx> constexpr auto Format(const BadlySpecifiedPoint& point, resultCtx& ctx) const {
+		formatter::format_to(std::back_inserter(ctx), "({:q})", point.x);
+	}
+};
+
+TEST_CASE("Error Codes: An Error In A Custom Formatter's Own Format Call Is Returned") {
+	std::string out { "kept" };
+	auto result { formatter::try_format_to(std::back_inserter(out), "{} {}", 1, BadlySpecifiedPoint { 2 }) };
+	REQUIRE(result.error() == ErrorType::invalid_int_spec);
+	REQUIRE(out == "kept");
+	REQUIRE(formatter::try_format_to(std::back_inserter(out), " {}", 3));
+	REQUIRE(out == "kept 3");
+}
+
+TEST_CASE("Error Codes: The Formatter Is Reusable After A Failure") {
+	formatter::arg_formatter::ArgFormatter formatter;
+	std::string out;
+	REQUIRE_FALSE(formatter.try_format_to(std::back_inserter(out), "{} {} {:q}", 1, 2, 3));
+	REQUIRE(formatter.try_format_to(std::back_inserter(out), "{} {} {}", 1, 2, 3));
+	REQUIRE(out == "1 2 3");
+}
+
+TEST_CASE("Error Codes: format_to() Still Throws After A try_format_to() Call") {
+	std::string out;
+	REQUIRE_FALSE(formatter::try_format_to(std::back_inserter(out), "{:q}", 1));
+	REQUIRE(formatter::try_format_to(std::back_inserter(out), "{}", 1));
+	REQUIRE_THROWS_AS(formatter::format("{:q}", 1), formatter::af_errors::error_handler::format_error);
+	REQUIRE_THROWS_AS(formatter::format("text {", 1), formatter::af_errors::error_handler::format_error);
+}
+
+TEST_CASE("Error Codes: Thrown Errors Carry The Same Code") {
+	try {
+			(void)formatter::format("{:q}", 1);
+			FAIL("expected a format_error");
+	} catch( const formatter::af_errors::error_handler::format_error& err ) {
+			REQUIRE(err.code() == ErrorType::invalid_int_spec);
+			REQUIRE(std::string_view(err.what()) == formatter::af_errors::format_result(err.code(), 0).message());
+		}
+}
+
+TEST_CASE("Error Codes: Setting The Error Callback Returns The Previous One") {
+	using formatter::af_errors::SetErrorCallback;
+	auto callback { [](ErrorType, const char*) {} };
+	REQUIRE(SetErrorCallback(callback) == &formatter::af_errors::PrintError);
+	REQUIRE(SetErrorCallback(nullptr) == static_cast<formatter::af_errors::error_callback>(callback));
+	REQUIRE(SetErrorCallback(nullptr) == &formatter::af_errors::PrintError);
+}
@@ -0,0 +1,185 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgFormatter.h"
+
+static std::string JsonReference(std::string_view text) {
+	std::string escaped;
+	for( auto c: text ) {
+			auto ch { static_cast<unsigned char>(c) };
+			switch( ch ) {
+					case '"': escaped += "\\\""; break;
+					case '\\': escaped += "\\\\"; break;
+					case '\b': escaped += "\\b"; break;
+					case '\f': escaped += "\\f"; break;
+					case '\n': escaped += "\\n"; break;
+					case '\r': escaped += "\\r"; break;
+					case '\t': escaped += "\\t"; break;
+					default:
+						if( ch < 0x20 ) {
+								constexpr std::string_view digits { "0123456789abcdef" };
+								escaped += "\\u00";
+								escaped += digits[ ch >> 4 ];
+								escaped += digits[ ch & 0x0F ];
+						} else {
+								escaped += c;
+							}
+						break;
+				}
+		}
+	return escaped;
+}
+
+TEST_CASE("JSON Escaping: Escape Sequences And String Types") {
+	std::string str { "say \"hi\"\\\n" };
+	std::string_view sv { "tab\there" };
+	const char* cstr { "bell\x07" };
+	REQUIRE(formatter::format("{:j}", str) == "say \\\"hi\\\"\\\\\\n");
+	REQUIRE(formatter::format("{:j}", sv) == "tab\\there");
+	REQUIRE(formatter::format("{:j}", cstr) == "bell\\u0007");
+	REQUIRE(formatter::format("{:j}", std::string_view { "\b\f\r\x1f" }) == "\\b\\f\\r\\u001f");
+	REQUIRE(formatter::format("{:j}", std::string_view { "clean text" }) == "clean text");
+	REQUIRE(formatter::format("{:j}", std::string_view {}) == "");
+	// bytes above 0x7F (utf-8 sequences) and DEL don't need escaping in JSON
+	REQUIRE(formatter::format("{:j}", std::string_view { "caf\xC3\xA9\x7F" }) == "caf\xC3\xA9\x7F");
+	REQUIRE(formatter::format(R"("level":"{}","msg":"{:j}")", "info", str) == R"("level":"info","msg":"say \"hi\"\\\n")");
+}
+
+TEST_CASE("JSON Escaping: Width And Precision Apply To The Escaped And Unescaped Text Respectively") {
+	REQUIRE(formatter::format("[{:_>8j}]", std::string_view { "a\"b" }) == "[____a\\\"b]");
+	REQUIRE(formatter::format("[{:_<8j}]", std::string_view { "a\"b" }) == "[a\\\"b____]");
+	REQUIRE(formatter::format("[{:.3j}]", std::string_view { "a\nbcdef" }) == "[a\\nb]");
+	REQUIRE_THROWS(formatter::format("{:j}", 42));
+	REQUIRE_THROWS(formatter::format("{:j}", 4.2));
+}
+
+TEST_CASE("JSON Escaping: Matches A Scalar Reference At Every Position") {
+	// every position of every escape across the 16 and 32 char blocks of the vectorized scan, along with every byte value
+	std::string text(80, 'a');
+	for( unsigned int value { 0 }; value < 256; ++value ) {
+			for( size_t pos: { 0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 79 } ) {
+					auto copy { text };
+					copy[ pos ] = static_cast<char>(value);
+					REQUIRE(formatter::format("{:j}", copy) == JsonReference(copy));
+				}
+		}
+	std::u16string wide;
+	formatter::format_to(std::back_inserter(wide), "{:j}", std::string_view { "a\"b" });
+	REQUIRE(wide == u"a\\\"b");
+}
+
+// A code point at a time, with none of the bulk scanning, as the reference for the debug spec
+static std::string DebugReference(std::string_view text, char delimiter) {
+	auto hex { [](uint32_t value) {
+		std::string digits;
+		do {
+				digits.insert(digits.begin(), "0123456789abcdef"[ value & 0x0F ]);
+				value >>= 4;
+		} while( value != 0 );
+		return digits;
+	} };
+	std::string escaped(1, delimiter);
+	auto previousEscaped { true };
+	while( !text.empty() ) {
+			char32_t codePoint {};
+			auto length { formatter::unicode::DecodeUtf8(text, codePoint) };
+			if( length == 0 ) {
+					escaped += "\\x{" + hex(static_cast<unsigned char>(text[ 0 ])) + "}";
+					previousEscaped = true;
+					text.remove_prefix(1);
+					continue;
+			}
+			if( codePoint == '\t' ) {
+					escaped += "\\t";
+			} else if( codePoint == '\n' ) {
+					escaped += "\\n";
+			} else if( codePoint == '\r' ) {
+					escaped += "\\r";
+			} else if( codePoint == '\\' || codePoint == static_cast<char32_t>(delimiter) ) {
+					escaped += '\\';
+					escaped += static_cast<char>(codePoint);
+			} else if( codePoint < 0x20 || codePoint == 0x7F || formatter::unicode::IsDebugEscaped(codePoint) ||
+			           (previousEscaped && formatter::unicode::IsGraphemeExtend(codePoint)) )
+				{
+					escaped += "\\u{" + hex(codePoint) + "}";
+			} else {
+					escaped.append(text.substr(0, length));
+					previousEscaped = false;
+					text.remove_prefix(length);
+					continue;
+				}
+			previousEscaped = true;
+			text.remove_prefix(length);
+		}
+	return escaped + delimiter;
+}
+
+TEST_CASE("Debug Spec: Strings And Chars Are Quoted And Escaped") {
+	REQUIRE(formatter::format("{:?}", std::string { "plain" }) == "\"plain\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "tab\there \"quoted\" 'single' back\\slash\r\n" }) ==
+	        "\"tab\\there \\\"quoted\\\" 'single' back\\\\slash\\r\\n\"");
+	REQUIRE(formatter::format("{:?}", "nul\x01 del\x7F") == "\"nul\\u{1} del\\u{7f}\"");
+	REQUIRE(formatter::format("{:?}", std::string_view {}) == "\"\"");
+	// printable non-ASCII text is left as-is while separators, format characters and ill-formed UTF-8 are escaped
+	REQUIRE(formatter::format("{:?}", std::string_view { "caf\xC3\xA9 \xE4\xB8\xAD" }) == "\"caf\xC3\xA9 \xE4\xB8\xAD\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xC2\xA0|\xE2\x80\x8B|\xEF\xBB\xBF" }) == "\"\\u{a0}|\\u{200b}|\\u{feff}\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xFF|\xC3|\xE2\x82" }) == "\"\\x{ff}|\\x{c3}|\\x{e2}\\x{82}\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xC0\xAF" }) == "\"\\x{c0}\\x{af}\"");
+	// a combining mark is only escaped when there's nothing for it to combine with
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xCC\x81" "e\xCC\x81" }) == "\"\\u{301}e\xCC\x81\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "\t\xCC\x81" }) == "\"\\t\\u{301}\"");
+
+	REQUIRE(formatter::format("{:?}", 'a') == "'a'");
+	REQUIRE(formatter::format("{:?}", '\'') == "'\\''");
+	REQUIRE(formatter::format("{:?}", '"') == "'\"'");
+	REQUIRE(formatter::format("{:?}", '\n') == "'\\n'");
+	REQUIRE(formatter::format("{:?}", '\0') == "'\\u{0}'");
+	REQUIRE(formatter::format("{:?}", static_cast<char>(0xE9)) == "'\\x{e9}'");
+	REQUIRE_THROWS(formatter::format("{:?}", 42));
+	REQUIRE_THROWS(formatter::format("{:?}", true));
+}
+
+TEST_CASE("Debug Spec: Width And Precision Count The Escaped Text") {
+	REQUIRE(formatter::format("[{:_>8?}]", std::string_view { "a\tb" }) == "[__\"a\\tb\"]");
+	REQUIRE(formatter::format("[{:_<8?}]", 'x') == "[\'x\'_____]");
+	REQUIRE(formatter::format("[{:.3?}]", std::string_view { "hello" }) == "[\"he]");
+	REQUIRE(formatter::format("[{:_>6.4?}]", std::string_view { "hello" }) == "[__\"hel]");
+}
+
+// The expected strings are what std::format writes for these (C++23 [format.string.escaped]), so unlike DebugReference() they don't depend on the
+// library's own tables
+TEST_CASE("Debug Spec: Unassigned Code Points And Leading Marks Are Escaped Like std::format") {
+	// U+0378 and U+E0080 are unassigned, U+FDD0, U+FFFE and U+10FFFF are noncharacters: all General_Category Cn
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xCD\xB8" }) == "\"\\u{378}\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xF3\xA0\x82\x80" }) == "\"\\u{e0080}\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "a\xEF\xB7\x90|\xEF\xBF\xBE|\xF4\x8F\xBF\xBF" }) == "\"a\\u{fdd0}|\\u{fffe}|\\u{10ffff}\"");
+	// U+0E31 (Thai), U+0981 (Bengali) and U+093A (Devanagari) are Grapheme_Extend marks: escaped at the start or after an escape, kept after the
+	// consonant they combine with (U+0E01, U+0995 and U+0915)
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xE0\xB8\xB1" }) == "\"\\u{e31}\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xE0\xA6\x81" }) == "\"\\u{981}\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xE0\xA4\xBA" }) == "\"\\u{93a}\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xE0\xB8\x81\xE0\xB8\xB1 \xE0\xA6\x95\xE0\xA6\x81 \xE0\xA4\x95\xE0\xA4\xBA" }) ==
+	        "\"\xE0\xB8\x81\xE0\xB8\xB1 \xE0\xA6\x95\xE0\xA6\x81 \xE0\xA4\x95\xE0\xA4\xBA\"");
+	REQUIRE(formatter::format("{:?}", std::string_view { "\xCD\xB8\xE0\xB8\xB1\n\xE0\xA6\x81" }) == "\"\\u{378}\\u{e31}\\n\\u{981}\"");
+}
+
+TEST_CASE("Debug Spec: Matches The Reference At Every Position") {
+	std::string text(80, 'a');
+	for( unsigned int value { 0 }; value < 256; ++value ) {
+			for( size_t pos: { 0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 79 } ) {
+					auto copy { text };
+					copy[ pos ] = static_cast<char>(value);
+					REQUIRE(formatter::format("{:?}", copy) == DebugReference(copy, '"'));
+				}
+			auto ch { static_cast<char>(value) };
+			REQUIRE(formatter::format("{:?}", ch) == DebugReference(std::string_view(&ch, 1), '\''));
+		}
+	// multi-byte sequences straddling the vector block boundaries
+	for( std::string_view sequence: { "\xC3\xA9", "\xE2\x80\xA8", "\xF0\x9F\x98\x80", "\xCC\x81", "\xEF\xBF\xBE", "\xF4\x90\x80\x80",
+	                                 "\xCD\xB8", "\xE0\xB8\xB1" } ) {
+			for( size_t pos: { 13, 14, 15, 30, 31 } ) {
+					auto copy { text };
+					copy.replace(pos, sequence.size(), sequence);
+					REQUIRE(formatter::format("{:?}", copy) == DebugReference(copy, '"'));
+				}
+		}
+}
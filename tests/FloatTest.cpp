@@ -0,0 +1,120 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgFormatter.h"
+
+#include <bit>
+#include <random>
+
+namespace {
+
+	template<typename T> std::string Reference(T value, int precision) {
+		char text[ 512 ] {};
+		auto end { std::to_chars(text, text + sizeof(text), value, std::chars_format::fixed, precision).ptr };
+		return std::string(text, end);
+	}
+
+	std::string FixedSpec(int precision, char type = 'f') {
+		return "{:." + std::to_string(precision) + type + "}";
+	}
+
+	// Every precision the fast path covers, plus one past it that always goes through std::to_chars()
+	template<typename T> void CheckAgainstToChars(T value) {
+		for( int precision { 1 }; precision <= formatter::arg_formatter::AF_FIXED_FAST_PRECISION + 1; ++precision ) {
+				auto expected { Reference(value, precision) };
+				// the argument buffer only has room for so many digits, which is a limit of the to_chars path as well
+				if( expected.size() > formatter::arg_formatter::AF_ARG_BUFFER_SIZE - 2 ) continue;
+				REQUIRE(formatter::format(std::string_view(FixedSpec(precision)), value) == expected);
+			}
+	}
+
+}    // namespace
+
+TEST_CASE("Fixed Precision: Common Values Match std::to_chars") {
+	for( double value: { 0.0, -0.0, 1.0, -1.0, 0.5, 3.14159265358979, -2.71828, 0.001, 0.0049999, 0.005, 0.015, 0.025, 1.005, 2.675, 99.995, 999999.9999,
+	                     123456789.123456789, 1e15, 1e-7, 5e-324, 2.2250738585072014e-308, 9007199254740993.0 } )
+		{
+			CheckAgainstToChars(value);
+			CheckAgainstToChars(static_cast<float>(value));
+		}
+	REQUIRE(formatter::format("{:.2f}", 3.14159) == "3.14");
+	REQUIRE(formatter::format("{:.3f}", -0.0005) == "-0.001");
+	REQUIRE(formatter::format("{:.2f}", -0.0) == "-0.00");
+	REQUIRE(formatter::format("{:f}", 1.5) == "1.500000");
+	REQUIRE(formatter::format("{:.2F}", 1.5) == "1.50");
+}
+
+TEST_CASE("Fixed Precision: Exact Ties Round To The Even Digit") {
+	// (2k + 1) / 2^j has exactly j fractional digits, so it's an exact tie at precision j - 1
+	for( int j { 1 }; j <= 12; ++j ) {
+			for( int k { 0 }; k < 64; ++k ) {
+					auto value { std::ldexp(2.0 * k + 1.0, -j) };
+					CheckAgainstToChars(value);
+					CheckAgainstToChars(-value);
+				}
+		}
+	REQUIRE(formatter::format("{:.2f}", 0.125) == "0.12");
+	REQUIRE(formatter::format("{:.2f}", 0.375) == "0.38");
+	REQUIRE(formatter::format("{:.1f}", 0.25) == "0.2");
+}
+
+TEST_CASE("Fixed Precision: Random Doubles And Floats Match std::to_chars") {
+	std::mt19937_64 rng { 2024 };
+	for( int i { 0 }; i < 20000; ++i ) {
+			// mostly magnitudes the fast path handles, with the rest spread over every exponent
+			auto bits { rng() };
+			if( i % 4 != 0 ) bits = (bits & 0x800F'FFFF'FFFF'FFFF) | (static_cast<uint64_t>(1023 - 30 + static_cast<int>(rng() % 70)) << 52);
+			auto value { std::bit_cast<double>(bits) };
+			if( !std::isfinite(value) ) continue;
+			CheckAgainstToChars(value);
+		}
+	// a sweep through the floats in [1, 2048), every 997th one
+	for( uint32_t bits { 0x3F80'0000 }; bits < 0x4500'0000; bits += 997 ) CheckAgainstToChars(std::bit_cast<float>(bits));
+}
+
+TEST_CASE("Fixed Precision: Around The Largest Value That Fits In 64 Bits Once Scaled") {
+	for( int precision { 1 }; precision <= formatter::arg_formatter::AF_FIXED_FAST_PRECISION; ++precision ) {
+			auto limit { 18446744073709551615.0 / std::pow(10.0, precision) };
+			for( auto value: { limit, std::nextafter(limit, 0.0), std::nextafter(limit, 1e300), limit / 2, limit * 2 } ) {
+					auto spec { FixedSpec(precision) };
+					REQUIRE(formatter::format(std::string_view(spec), value) == Reference(value, precision));
+				}
+		}
+}
+
+TEST_CASE("Fixed Precision: Signs, Alignment And Values That Aren't Finite") {
+	REQUIRE(formatter::format("{:+.2f}", 1.5) == "+1.50");
+	REQUIRE(formatter::format("{:+.2f}", -1.5) == "-1.50");
+	REQUIRE(formatter::format("{: .2f}", 1.5) == " 1.50");
+	REQUIRE(formatter::format("{:+.2f}", -0.0) == "-0.00");
+	REQUIRE(formatter::format("[{:>8.2f}]", 3.14159) == "[    3.14]");
+	REQUIRE(formatter::format("[{:08.3f}]", -3.14159) == "[-003.142]");
+	REQUIRE(formatter::format("{:.2f}", std::numeric_limits<double>::infinity()) == "inf");
+	REQUIRE(formatter::format("{:.2F}", -std::numeric_limits<double>::infinity()) == "-INF");
+	REQUIRE(formatter::format("{:.2f}", std::numeric_limits<double>::quiet_NaN()) == "nan");
+	REQUIRE(formatter::format("{:.2f}", 1.5L) == "1.50");
+}
+
+TEST_CASE("Floating Point Signs: Negative Zero And Negative NaN Keep A Single Minus Sign") {
+	auto negativeNan { std::copysign(std::numeric_limits<double>::quiet_NaN(), -1.0) };
+	REQUIRE(formatter::format("{:+}", -0.0) == "-0");
+	REQUIRE(formatter::format("{: }", -0.0) == "-0");
+	REQUIRE(formatter::format("{:+.2f}", -0.0) == "-0.00");
+	REQUIRE(formatter::format("{:+e}", -0.0f) == "-0.000000e+00");
+	REQUIRE(formatter::format("{:+}", 0.0) == "+0");
+	REQUIRE(formatter::format("{:+}", negativeNan) == "-nan");
+	REQUIRE(formatter::format("{: }", negativeNan) == "-nan");
+	REQUIRE(formatter::format("{:+}", std::numeric_limits<double>::quiet_NaN()) == "+nan");
+}
+
+TEST_CASE("Floating Point Case: The Upper Case Types Also Upper Case inf And nan") {
+	auto infinity { std::numeric_limits<double>::infinity() };
+	auto nan { std::numeric_limits<double>::quiet_NaN() };
+	REQUIRE(formatter::format("{:F}", infinity) == "INF");
+	REQUIRE(formatter::format("{:F}", -infinity) == "-INF");
+	REQUIRE(formatter::format("{:+F}", infinity) == "+INF");
+	REQUIRE(formatter::format("{:E}", nan) == "NAN");
+	REQUIRE(formatter::format("{:G}", -infinity) == "-INF");
+	REQUIRE(formatter::format("{:A}", nan) == "NAN");
+	REQUIRE(formatter::format("{:f}", infinity) == "inf");
+	REQUIRE(formatter::format("{:.2E}", 1.5) == "1.50E+00");
+}
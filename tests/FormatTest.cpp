@@ -514,3 +514,14 @@ TEST_CASE("Custom Formatting: Position And Placement Test With And Without Other
 	// clang-format on
 }
 ////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Time Formatting: A Time Field Following Another Field Only Writes Its Own Value") {
+	std::tm time {};
+	time.tm_year = 124;
+	time.tm_mon  = 4;
+	time.tm_mday = 17;
+
+	REQUIRE(formatter::format("{:x} {:%Y}", 255, time) == "ff 2024");
+	REQUIRE(formatter::format("{} {:%Y-%m-%d}", 424242, time) == "424242 2024-05-17");
+	REQUIRE(formatter::format("{:%Y} {:%Y}", time, time) == "2024 2024");
+}
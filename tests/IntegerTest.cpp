@@ -0,0 +1,107 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgFormatter.h"
+
+#include <random>
+
+namespace {
+
+	// What std::to_chars() writes for 'value', upper cased when asked to
+	template<typename T> std::string Reference(T value, int base, bool upper = false) {
+		char text[ 72 ] {};
+		auto end { std::to_chars(text, text + sizeof(text), value, base).ptr };
+		std::string result(text, end);
+		if( upper ) {
+				for( auto& ch: result ) ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+		}
+		return result;
+	}
+
+	template<typename T> std::vector<T> InterestingValues() {
+		std::vector<T> values { 0, 1, std::numeric_limits<T>::max(), static_cast<T>(std::numeric_limits<T>::max() - 1) };
+		if constexpr( std::is_signed_v<T> ) {
+				values.insert(values.end(), { -1, std::numeric_limits<T>::min(), static_cast<T>(std::numeric_limits<T>::min() + 1) });
+		}
+		for( unsigned shift { 0 }; shift < std::numeric_limits<T>::digits; ++shift ) {
+				auto power { static_cast<T>(T { 1 } << shift) };
+				values.insert(values.end(), { power, static_cast<T>(power - 1), static_cast<T>(power + 1) });
+			}
+		std::mt19937_64 rng { 42 };
+		for( int i { 0 }; i < 2000; ++i ) {
+				// a random width as well as a random value, so that short values aren't drowned out by full width ones
+				auto bits { rng() >> (rng() % 64) };
+				values.push_back(static_cast<T>(bits));
+			}
+		return values;
+	}
+
+	template<typename T> void CheckEveryBase() {
+		for( auto value: InterestingValues<T>() ) {
+				REQUIRE(formatter::format("{:x}", value) == Reference(value, 16));
+				REQUIRE(formatter::format("{:X}", value) == Reference(value, 16, true));
+				REQUIRE(formatter::format("{:o}", value) == Reference(value, 8));
+				REQUIRE(formatter::format("{:b}", value) == Reference(value, 2));
+				REQUIRE(formatter::format("{:B}", value) == Reference(value, 2));
+				REQUIRE(formatter::format("{:d}", value) == Reference(value, 10));
+			}
+	}
+
+}    // namespace
+
+TEST_CASE("Integer Bases: Every Type Matches std::to_chars") {
+	CheckEveryBase<int>();
+	CheckEveryBase<unsigned int>();
+	CheckEveryBase<long long>();
+	CheckEveryBase<unsigned long long>();
+}
+
+TEST_CASE("Integer Bases: The Sign Comes Before The Base Prefix") {
+	REQUIRE(formatter::format("{:#x}", 255) == "0xff");
+	REQUIRE(formatter::format("{:#x}", -255) == "-0xff");
+	REQUIRE(formatter::format("{:#X}", -255) == "-0XFF");
+	REQUIRE(formatter::format("{:#b}", -5) == "-0b101");
+	REQUIRE(formatter::format("{:#B}", 5) == "0B101");
+	REQUIRE(formatter::format("{:#o}", -8) == "-010");
+	REQUIRE(formatter::format("{:+#x}", 255) == "+0xff");
+	REQUIRE(formatter::format("{: #x}", 255) == " 0xff");
+	REQUIRE(formatter::format("{: x}", -255) == "-ff");
+	REQUIRE(formatter::format("{:#x}", std::numeric_limits<long long>::min()) == "-0x8000000000000000");
+	REQUIRE(formatter::format("{:#b}", std::numeric_limits<int>::min()) == "-0b10000000000000000000000000000000");
+	REQUIRE(formatter::format("[{:*>8x}]", -255) == "[*****-ff]");
+}
+
+TEST_CASE("Integer Bases: Bools, Chars And Pointers") {
+	REQUIRE(formatter::format("{:x}", 'A') == "41");
+	REQUIRE(formatter::format("{:#b}", true) == "0b1");
+	REQUIRE(formatter::format("{:o}", false) == "0");
+	auto address { reinterpret_cast<const void*>(0xDEADBEEF) };
+	REQUIRE(formatter::format("{}", address) == "0xdeadbeef");
+	REQUIRE(formatter::format("{}", static_cast<const void*>(nullptr)) == "0x0");
+}
+
+TEST_CASE("Integer Bases: The Digit Kernels Zero Extend To The Requested Width") {
+	char text[ 80 ] {};
+	auto end { formatter::simd::WriteHexDigits(0xABC, 16, text, true) };
+	REQUIRE(std::string(text, end) == "0000000000000ABC");
+	end = formatter::simd::WriteHexDigits(0xABC, 5, text, false);
+	REQUIRE(std::string(text, end) == "00abc");
+	end = formatter::simd::WriteOctalDigits(8, 7, text);
+	REQUIRE(std::string(text, end) == "0000010");
+	end = formatter::simd::WriteBinaryDigits(5, 20, text);
+	REQUIRE(std::string(text, end) == "00000000000000000101");
+	end = formatter::simd::WriteBinaryDigits(~0ULL, 64, text);
+	REQUIRE(std::string(text, end) == std::string(64, '1'));
+}
+
+TEST_CASE("Integer Types: long And unsigned long Format Like Their Same-Width Types") {
+	REQUIRE(formatter::format("{}", 42L) == "42");
+	REQUIRE(formatter::format("{}", -42L) == "-42");
+	REQUIRE(formatter::format("{}", 42UL) == "42");
+	REQUIRE(formatter::format("{}", std::numeric_limits<long>::min()) == std::to_string(std::numeric_limits<long>::min()));
+	REQUIRE(formatter::format("{}", std::numeric_limits<long>::max()) == std::to_string(std::numeric_limits<long>::max()));
+	REQUIRE(formatter::format("{}", std::numeric_limits<unsigned long>::max()) == std::to_string(std::numeric_limits<unsigned long>::max()));
+	REQUIRE(formatter::format("{}", size_t { 12345 }) == "12345");
+	REQUIRE(formatter::format("{:x}", 255UL) == "ff");
+	REQUIRE(formatter::format("[{:>6}]", -7L) == "[    -7]");
+	REQUIRE(formatter::format("{} {} {}", 1L, 2UL, 3) == "1 2 3");
+}
@@ -0,0 +1,111 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgFormatter.h"
+#include "AllocationCounter.h"
+
+#include <ctime>
+
+namespace {
+
+	// A German-style numpunct that doesn't depend on which named locales happen to be installed
+	struct test_numpunct: std::numpunct<char>
+	{
+		explicit test_numpunct(std::string groups): groups(std::move(groups)) { }
+		char do_thousands_sep() const override {
+			return '.';
+		}
+		char do_decimal_point() const override {
+			return ',';
+		}
+		std::string do_grouping() const override {
+			return groups;
+		}
+		std::string do_truename() const override {
+			return "wahr";
+		}
+		std::string do_falsename() const override {
+			return "falsch";
+		}
+		std::string groups;
+	};
+
+	std::locale TestLocale(std::string groups = "\3") {
+		return std::locale(std::locale::classic(), new test_numpunct(std::move(groups)));
+	}
+
+	std::tm TestTime() {
+		std::tm time {};
+		time.tm_year = 124;
+		time.tm_mon  = 2;
+		time.tm_mday = 5;
+		time.tm_hour = 13;
+		time.tm_min  = 7;
+		time.tm_sec  = 9;
+		time.tm_wday = 2;
+		return time;
+	}
+
+	// Formats twice to warm up any storage that's reused, then returns how many allocations 100 more calls made
+	template<typename Format> size_t CountAllocations(Format&& format) {
+		std::string out;
+		out.reserve(1024);
+		format(out);
+		format(out);
+		af_test::StartCountingAllocations();
+		for( int i { 0 }; i < 100; ++i ) {
+				out.clear();
+				format(out);
+			}
+		return af_test::StopCountingAllocations();
+	}
+
+}    // namespace
+
+TEST_CASE("Localized Numbers Follow The Locale's Grouping") {
+	struct GroupingCase
+	{
+		std::string groups;
+		std::array<std::string_view, 5> expected;
+	};
+	// values: 123, 1234, -1234567, 123456789012 and -1234567.5 with "{:+.3Lf}"
+	for( const auto& [ groups, expected ]: { GroupingCase { "\3", { "123", "1.234", "-1.234.567", "123.456.789.012", "-1.234.567,500" } },
+	                                        GroupingCase { "\3\2", { "123", "1.234", "-12.34.567", "1.23.45.67.89.012", "-12.34.567,500" } },
+	                                        GroupingCase { "\1\2\3", { "12.3", "1.23.4", "-1.234.56.7", "123.456.789.01.2", "-1.234.56.7,500" } },
+	                                        GroupingCase { "\2\177", { "1.23", "12.34", "-12345.67", "1234567890.12", "-12345.67,500" } },
+	                                        GroupingCase { "", { "123", "1234", "-1234567", "123456789012", "-1234567,500" } } } )
+		{
+			auto locale { TestLocale(groups) };
+			REQUIRE(formatter::format(locale, "{:L}", 123) == expected[ 0 ]);
+			REQUIRE(formatter::format(locale, "{:L}", 1234) == expected[ 1 ]);
+			REQUIRE(formatter::format(locale, "{:L}", -1234567) == expected[ 2 ]);
+			REQUIRE(formatter::format(locale, "{:L}", 123456789012LL) == expected[ 3 ]);
+			REQUIRE(formatter::format(locale, "{:+.3Lf}", -1234567.5) == expected[ 4 ]);
+		}
+	auto locale { TestLocale() };
+	REQUIRE(formatter::format(locale, "{:L}", true) == "wahr");
+	REQUIRE(formatter::format(locale, "{:L}", false) == "falsch");
+	REQUIRE(formatter::format(locale, "[{:>12L}]", 1234567) == "[   1.234.567]");
+}
+
+TEST_CASE("Localized Time Keeps Literals") {
+	auto locale { TestLocale() };
+	auto time { TestTime() };
+	REQUIRE(formatter::format(locale, "{:L%H:%M:%S}", time) == "13:07:09");
+	REQUIRE(formatter::format(locale, "{:L%Y-%m-%d %%}", time) == "2024-03-05 %");
+	REQUIRE(formatter::format(locale, "[{:>10L%H:%M}]", time) == "[     13:07]");
+	REQUIRE(formatter::format(locale, "[{:<10L%H:%M}]", time) == "[13:07     ]");
+	// a lone spec without a width has to go through the locale too rather than the unlocalized single spec shortcut
+	REQUIRE(formatter::format(locale, "{:L%H}", time) == "13");
+	REQUIRE(formatter::format(locale, "{:L%Y}", time) == "2024");
+	REQUIRE(formatter::format(locale, "{:L%c}", time) == "Tue Mar  5 13:07:09 2024");
+}
+
+TEST_CASE("Localized Formatting Doesn't Allocate Once Warmed Up") {
+	auto locale { TestLocale() };
+	auto time { TestTime() };
+	REQUIRE(CountAllocations([ & ](std::string& out) { formatter::format_to(std::back_inserter(out), locale, "{:L}", 1234567); }) == 0);
+	REQUIRE(CountAllocations([ & ](std::string& out) { formatter::format_to(std::back_inserter(out), locale, "{:.2Lf}", 1234567.891); }) == 0);
+	REQUIRE(CountAllocations([ & ](std::string& out) { formatter::format_to(std::back_inserter(out), locale, "{:L}", true); }) == 0);
+	REQUIRE(CountAllocations([ & ](std::string& out) { formatter::format_to(std::back_inserter(out), locale, "{:L%H:%M:%S}", time); }) == 0);
+	REQUIRE(CountAllocations([ & ](std::string& out) { formatter::format_to(std::back_inserter(out), locale, "{:>20L%c}", time); }) == 0);
+}
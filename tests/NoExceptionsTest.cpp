@@ -0,0 +1,112 @@
+#include "catch.hpp"
+
+// Built on its own as Formatting_Tests_NoExceptions with exceptions disabled and AF_NO_EXCEPTIONS/AF_NO_LOCALE defined, so that the error callback
+// and the classic 'L' fallback are covered the way those builds of the library see them
+#include "../include/ArgFormatter/ArgFormatter.h"
+
+#if !defined(AF_NO_EXCEPTIONS) || !defined(AF_NO_LOCALE)
+	#error "NoExceptionsTest.cpp Is Only Meant To Be Built With AF_NO_EXCEPTIONS And AF_NO_LOCALE Defined"
+#endif
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+
+#if !defined(_WIN32)
+	#include <sys/wait.h>
+	#include <unistd.h>
+#endif
+
+using formatter::af_errors::ErrorType;
+
+TEST_CASE("No Exceptions Build: The 'L' Flag Falls Back To Classic Formatting") {
+	REQUIRE(formatter::format("{:L}", 1234567) == "1234567");
+	REQUIRE(formatter::format("{:L}", -1234567ll) == "-1234567");
+	REQUIRE(formatter::format("[{:>10L}]", 1234567u) == "[   1234567]");
+	REQUIRE(formatter::format("{:.2Lf}", 1234.5) == "1234.50");
+	REQUIRE(formatter::format("{:L}", 1234.5) == "1234.5");
+	REQUIRE(formatter::format("{:L}", true) == "true");
+
+	std::tm time {};
+	time.tm_year = 124;
+	time.tm_mon  = 1;
+	time.tm_mday = 29;
+	time.tm_hour = 13;
+	time.tm_min  = 5;
+	REQUIRE(formatter::format("{:L%Y-%m-%d %H:%M}", time) == "2024-02-29 13:05");
+	REQUIRE(formatter::format("{:L%Y-%m-%d %H:%M}", time) == formatter::format("{:%Y-%m-%d %H:%M}", time));
+}
+
+TEST_CASE("No Exceptions Build: Setting The Error Callback Returns The Previous One") {
+	using formatter::af_errors::SetErrorCallback;
+	auto callback { [](ErrorType, const char*) {} };
+	REQUIRE(SetErrorCallback(callback) == &formatter::af_errors::PrintError);
+	REQUIRE(SetErrorCallback(nullptr) == static_cast<formatter::af_errors::error_callback>(callback));
+}
+
+TEST_CASE("No Exceptions Build: try_format_to() Returns Errors Instead Of Reporting Them") {
+	static int reported { 0 };
+	// the callback would be followed by an abort, so a call that reached it wouldn't get as far as the check below anyway
+	auto previous { formatter::af_errors::SetErrorCallback([](ErrorType, const char*) { ++reported; }) };
+	std::string out { "kept" };
+	auto result { formatter::try_format_to(std::back_inserter(out), "{} {:q}", 1, 2) };
+	REQUIRE_FALSE(result);
+	REQUIRE(result.error() == ErrorType::invalid_int_spec);
+	REQUIRE(formatter::try_format_to(std::back_inserter(out), "text {", 1).error() == ErrorType::missing_bracket);
+	REQUIRE(out == "kept");
+	REQUIRE(formatter::try_format_to(std::back_inserter(out), " {}", 3).value() == 2);
+	REQUIRE(out == "kept 3");
+	REQUIRE(reported == 0);
+	formatter::af_errors::SetErrorCallback(previous);
+}
+
+#if !defined(_WIN32)
+
+namespace {
+
+	constexpr int reportedExit { 42 };
+	constexpr int wrongErrorExit { 43 };
+	constexpr int returnedExit { 44 };
+
+	// Runs 'body' in a child process, since an error ends the process in this build, and returns how the child ended
+	template<typename Body> int RunInChild(Body&& body) {
+		auto pid { ::fork() };
+		REQUIRE(pid != -1);
+		if( pid == 0 ) {
+				// Catch's own fatal signal handlers are inherited and would report the expected abort as a failure
+				std::signal(SIGABRT, SIG_DFL);
+				body();
+				std::_Exit(returnedExit);
+		}
+		int status { 0 };
+		REQUIRE(::waitpid(pid, &status, 0) == pid);
+		return status;
+	}
+
+}    // namespace
+
+TEST_CASE("No Exceptions Build: Errors Are Handed To The Error Callback") {
+	auto status { RunInChild([] {
+		formatter::af_errors::SetErrorCallback([](ErrorType err, const char* message) {
+			using formatter::af_errors::error_handler;
+			auto expected { err == ErrorType::invalid_int_spec &&
+			                std::strcmp(message, error_handler::format_error_messages[ static_cast<size_t>(ErrorType::invalid_int_spec) ]) == 0 };
+			std::_Exit(expected ? reportedExit : wrongErrorExit);
+		});
+		(void)formatter::format("{} {:q}", 1, 2);
+	}) };
+	REQUIRE(WIFEXITED(status));
+	REQUIRE(WEXITSTATUS(status) == reportedExit);
+}
+
+TEST_CASE("No Exceptions Build: The Process Is Aborted When The Callback Returns") {
+	auto status { RunInChild([] {
+		// keep the default callback's message out of the test output
+		(void)std::freopen("/dev/null", "w", stderr);
+		(void)formatter::format("text {", 1);
+	}) };
+	REQUIRE(WIFSIGNALED(status));
+	REQUIRE(WTERMSIG(status) == SIGABRT);
+}
+
+#endif    // !_WIN32
@@ -0,0 +1,195 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgBatch.h"
+#include <array>
+#include <span>
+
+using namespace formatter::arg_formatter;
+
+TEST_CASE("Range Formatting: Default, No Bracket And Element Specs") {
+	std::vector<int> ints { 1, -2, 3, 255 };
+	std::vector<double> doubles { 1.5, 2.25, -0.125 };
+	std::array<unsigned long long, 3> wide { 4, 5, 18'446'744'073'709'551'615ull };
+	std::vector<std::string> strings { "a", "bc", "" };
+	std::vector<std::string_view> views { "x", "yz" };
+
+	REQUIRE(formatter::format("{}", ints) == "[1, -2, 3, 255]");
+	REQUIRE(formatter::format("{0}", ints) == "[1, -2, 3, 255]");
+	REQUIRE(formatter::format("{}", doubles) == "[1.5, 2.25, -0.125]");
+	REQUIRE(formatter::format("{}", wide) == "[4, 5, 18446744073709551615]");
+	REQUIRE(formatter::format("{}", strings) == "[a, bc, ]");
+	REQUIRE(formatter::format("{:n}", views) == "x, yz");
+	REQUIRE(formatter::format("{:n}", ints) == "1, -2, 3, 255");
+	REQUIRE(formatter::format("{::x}", std::vector<int> { 10, 255 }) == "[a, ff]");
+	REQUIRE(formatter::format("{:n:#x}", std::vector<int> { 10, 255 }) == "0xa, 0xff");
+	REQUIRE(formatter::format("{::.2f}", doubles) == "[1.50, 2.25, -0.12]");
+	REQUIRE(formatter::format("{::_>3}", strings) == "[__a, _bc, ___]");
+	REQUIRE(formatter::format("{::_>3}", std::span<const int>(ints.data(), 2)) == "[__1, _-2]");
+	REQUIRE(formatter::format("{}", std::vector<int> {}) == "[]");
+}
+
+TEST_CASE("Range Formatting: Mixed With Other Arguments") {
+	std::vector<int> ints { 1, 2, 3 };
+	std::vector<float> floats { 0.5f, 4.0f };
+	REQUIRE(formatter::format("{:_^5}|{}|{}", 42, ints, "end") == "_42__|[1, 2, 3]|end");
+	REQUIRE(formatter::format("{1} before {0:n}", ints, floats) == "[0.5, 4] before 1, 2, 3");
+	REQUIRE(formatter::format("ints={} floats={::.1f}", ints, floats) == "ints=[1, 2, 3] floats=[0.5, 4.0]");
+}
+
+TEST_CASE("Range Formatting: Custom Separators And Brackets") {
+	std::vector<int> ints { 1, 2, 3 };
+	std::vector<std::string> strings { "a", "b" };
+	REQUIRE(formatter::format("{}", formatter::join(ints, " | ")) == "1 | 2 | 3");
+	REQUIRE(formatter::format("{}", formatter::join(ints, "-", "<", ">")) == "<1-2-3>");
+	REQUIRE(formatter::format("{:n}", formatter::join(ints, "-", "<", ">")) == "1-2-3");
+	REQUIRE(formatter::format("{::x}", formatter::join(std::vector<int> { 26, 27 }, ",")) == "1a,1b");
+	REQUIRE(formatter::format("{}", formatter::join(strings, "/", "(", ")")) == "(a/b)");
+}
+
+TEST_CASE("Range Formatting: Large Numeric Ranges Span Several Blocks") {
+	std::vector<long long> values(100'000);
+	std::string expected { "[" };
+	for( size_t i { 0 }; i < values.size(); ++i ) {
+			values[ i ] = static_cast<long long>(i) * 1'000'003 - 50'000;
+			if( i != 0 ) expected.append(", ");
+			expected.append(std::to_string(values[ i ]));
+		}
+	expected.append("]");
+	REQUIRE(formatter::format("{}", values) == expected);
+	// a separator too long for the block path still formats through the per-element path
+	std::string longSeparator(formatter::arg_formatter::AF_RANGE_BLOCK_SIZE, ';');
+	auto joined { formatter::format("{}", formatter::join(std::span<const long long>(values.data(), 3), longSeparator)) };
+	REQUIRE(joined == std::to_string(values[ 0 ]) + longSeparator + std::to_string(values[ 1 ]) + longSeparator + std::to_string(values[ 2 ]));
+}
+
+TEST_CASE("Range Formatting: Invalid Range Spec Reports An Error") {
+	std::vector<int> ints { 1, 2 };
+	REQUIRE_THROWS(formatter::format("{:q}", ints));
+	REQUIRE_THROWS(formatter::format("{:nx}", ints));
+	// 'L' goes in the element spec rather than on the range itself
+	REQUIRE_THROWS(formatter::format("{:L}", ints));
+	REQUIRE(formatter::format("{::L}", ints) == "[1, 2]");
+}
+
+// A contiguous range with a CustomFormatter of its own is formatted by it rather than natively
+struct SampleWindow: std::vector<int>
+{
+	using std::vector<int>::vector;
+};
+template<> struct formatter::CustomFormatter<SampleWindow>
+{
+	constexpr void Parse(std::string_view) { }
+	template<typename resultCtx> constexpr auto Format(const SampleWindow& window, resultCtx& ctx) const {
+		formatter::format_to(std::back_inserter(ctx), "{} samples", window.size());
+	}
+};
+
+TEST_CASE("Range Formatting: A CustomFormatter Specialization Takes Precedence") {
+	static_assert(formatter::msg_details::GetArgType(SampleWindow {}) == formatter::msg_details::SpecType::CustomType);
+	static_assert(formatter::msg_details::GetArgType(std::vector<int> {}) == formatter::msg_details::SpecType::RangeType);
+	SampleWindow window { 1, 2, 3 };
+	REQUIRE(formatter::format("{}", window) == "3 samples");
+	REQUIRE(formatter::format("[{}] {}", window, std::vector<int>(window)) == "[3 samples] [1, 2, 3]");
+}
+
+TEST_CASE("Range Formatting: Parse-Once Rows Match Per-Call Formatting") {
+	using Row = std::tuple<int, std::vector<int>>;
+	std::vector<Row> rows;
+	for( int i { 0 }; i < 50; ++i ) rows.emplace_back(i, std::vector<int>(static_cast<size_t>(i % 5), i));
+	for( std::string_view fmt: { "{}: {}\n", "{}: {:n:x}\n" } ) {
+			ArgFormatter formatter;
+			std::string expected, batched;
+			for( auto& [ id, values ]: rows ) formatter.format_to(std::back_inserter(expected), fmt, id, values);
+			formatter.format_rows_to(std::back_inserter(batched), fmt, rows);
+			REQUIRE(batched == expected);
+		}
+}
+
+TEST_CASE("Byte Range Formatting: Hex, Grouped Hex And Hexdump") {
+	std::vector<std::byte> bytes { std::byte { 0xDE }, std::byte { 0xAD }, std::byte { 0xBE }, std::byte { 0xEF }, std::byte { 0x01 } };
+	REQUIRE(formatter::format("{}", bytes) == "[222, 173, 190, 239, 1]");
+	REQUIRE(formatter::format("{:x}", bytes) == "deadbeef01");
+	REQUIRE(formatter::format("{:X}", bytes) == "DEADBEEF01");
+	REQUIRE(formatter::format("{:x2}", bytes) == "dead beef 01");
+	REQUIRE(formatter::format("{:X4}", bytes) == "DEADBEEF 01");
+	REQUIRE(formatter::format("{::x}", bytes) == "[de, ad, be, ef, 1]");
+	REQUIRE(formatter::format("{:x}", std::vector<unsigned char> {}) == "");
+
+	std::string text { "Hello, World!\n" };
+	std::span<const unsigned char> textBytes(reinterpret_cast<const unsigned char*>(text.data()), text.size());
+	REQUIRE(formatter::format("{:h}", textBytes) == "00000000  48 65 6c 6c 6f 2c 20 57  6f 72 6c 64 21 0a        |Hello, World!.|\n");
+	std::vector<unsigned char> lines(20, 0xAB);
+	REQUIRE(formatter::format("{:H}", lines) ==
+	        "00000000  AB AB AB AB AB AB AB AB  AB AB AB AB AB AB AB AB  |................|\n"
+	        "00000010  AB AB AB AB                                       |....|\n");
+
+	REQUIRE_THROWS(formatter::format("{:h4}", lines));
+	REQUIRE_THROWS(formatter::format("{:xq}", lines));
+}
+
+TEST_CASE("Byte Range Formatting: Hex Matches Per-Byte Formatting For Every Length And Container") {
+	std::vector<unsigned char> payload(1'000);
+	for( size_t i { 0 }; i < payload.size(); ++i ) payload[ i ] = static_cast<unsigned char>(i * 131 + 7);
+	// the lengths straddle the 16 and 32 byte vector widths so the scalar tails are covered as well
+	for( size_t size: { 0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 999, 1'000 } ) {
+			std::span<const unsigned char> bytes(payload.data(), size);
+			std::string expected, grouped;
+			for( size_t i { 0 }; i < size; ++i ) {
+					if( i != 0 && i % 8 == 0 ) grouped += ' ';
+					auto byteHex { formatter::format("{:_>2x}", static_cast<unsigned int>(payload[ i ])) };
+					if( byteHex[ 0 ] == '_' ) byteHex[ 0 ] = '0';
+					expected += byteHex;
+					grouped += byteHex;
+				}
+			REQUIRE(formatter::format("{:x}", bytes) == expected);
+			REQUIRE(formatter::format("{:x8}", bytes) == grouped);
+			std::vector<char> asVector;
+			formatter::format_to(std::back_inserter(asVector), "{:x}", bytes);
+			REQUIRE(std::string(asVector.begin(), asVector.end()) == expected);
+		}
+	// larger than the stack block so a non-char container is written in several chunks
+	std::vector<unsigned char> large(10'000, 0x5A);
+	std::u16string wide, expected;
+	for( size_t i { 0 }; i < large.size(); ++i ) expected.append(u"5a");
+	formatter::format_to(std::back_inserter(wide), "{:x}", large);
+	REQUIRE(wide == expected);
+}
+
+static std::string Base64Reference(std::span<const unsigned char> bytes) {
+	constexpr std::string_view digits { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/" };
+	std::string encoded;
+	for( size_t i { 0 }; i < bytes.size(); i += 3 ) {
+			uint32_t bits { static_cast<uint32_t>(bytes[ i ]) << 16 };
+			if( i + 1 < bytes.size() ) bits |= static_cast<uint32_t>(bytes[ i + 1 ]) << 8;
+			if( i + 2 < bytes.size() ) bits |= bytes[ i + 2 ];
+			encoded += digits[ bits >> 18 ];
+			encoded += digits[ (bits >> 12) & 0x3F ];
+			encoded += i + 1 < bytes.size() ? digits[ (bits >> 6) & 0x3F ] : '=';
+			encoded += i + 2 < bytes.size() ? digits[ bits & 0x3F ] : '=';
+		}
+	return encoded;
+}
+
+TEST_CASE("Byte Range Formatting: Base64") {
+	auto asBytes { [](std::string_view text) { return std::span<const unsigned char>(reinterpret_cast<const unsigned char*>(text.data()), text.size()); } };
+	REQUIRE(formatter::format("{:b64}", asBytes("")) == "");
+	REQUIRE(formatter::format("{:b64}", asBytes("f")) == "Zg==");
+	REQUIRE(formatter::format("{:b64}", asBytes("fo")) == "Zm8=");
+	REQUIRE(formatter::format("{:b64}", asBytes("foo")) == "Zm9v");
+	REQUIRE(formatter::format("{:b64}", asBytes("foobar")) == "Zm9vYmFy");
+	REQUIRE(formatter::format("token={:b64};", asBytes("any carnal pleasure.")) == "token=YW55IGNhcm5hbCBwbGVhc3VyZS4=;");
+	REQUIRE_THROWS(formatter::format("{:b6}", asBytes("foo")));
+	REQUIRE_THROWS(formatter::format("{:b64x}", asBytes("foo")));
+
+	std::vector<unsigned char> payload(5'000);
+	for( size_t i { 0 }; i < payload.size(); ++i ) payload[ i ] = static_cast<unsigned char>(i * 89 + 3);
+	// the lengths straddle the 12, 16, 24 and 28 byte steps of the vector kernels
+	for( size_t size: { 1, 2, 11, 12, 13, 15, 16, 17, 23, 24, 25, 27, 28, 29, 100, 4'999, 5'000 } ) {
+			std::span<const unsigned char> bytes(payload.data(), size);
+			auto expected { Base64Reference(bytes) };
+			REQUIRE(formatter::format("{:b64}", bytes) == expected);
+			std::u16string wide;
+			formatter::format_to(std::back_inserter(wide), "{:b64}", bytes);
+			REQUIRE(wide == std::u16string(expected.begin(), expected.end()));
+		}
+}
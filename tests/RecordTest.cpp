@@ -0,0 +1,140 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgFormatter.h"
+
+#include <thread>
+
+using namespace formatter::arg_formatter;
+using formatter::msg_details::ArgRecord;
+using formatter::msg_details::ArgRecordView;
+using formatter::msg_details::RecordRingBuffer;
+
+TEST_CASE("Deferred Record Matches Synchronous Formatting") {
+	ArgFormatter formatter;
+	std::string str { "a std::string arg" };
+	std::string_view sv { "a string_view arg" };
+	const char* cstr { "a const char* arg" };
+	int value { 42 };
+	std::tm time {};
+	time.tm_year = 123;
+	time.tm_mon  = 4;
+	time.tm_mday = 17;
+
+	static constexpr std::string_view fmt { "{} {} {} {} {} {} {} {} {} {:.3f} {} {} {:%Y-%m-%d}" };
+	ArgRecord record(fmt, -7, 7u, -7ll, 7ull, true, 'z', 1.5f, 2.25, 3.125L, 0.1, str, sv, time);
+	REQUIRE(record.View().ArgCount() == 13);
+	REQUIRE(record.View().FormatString().data() == fmt.data());
+	REQUIRE(formatter.format_record(record.View()) == formatter.format(fmt, -7, 7u, -7ll, 7ull, true, 'z', 1.5f, 2.25, 3.125L, 0.1, str, sv, time));
+
+	ArgRecord strings("[{:_>20}] [{:.4}] [{}] [{:p}]", cstr, str, "literal", static_cast<const void*>(&value));
+	REQUIRE(formatter.format_record(strings.View()) ==
+	        formatter.format("[{:_>20}] [{:.4}] [{}] [{:p}]", cstr, str, "literal", static_cast<const void*>(&value)));
+}
+
+TEST_CASE("Deferred Record Stores Only The Standard std::tm Fields") {
+	ArgFormatter formatter;
+	// the same time twice, but with different bytes in whatever padding and extra members the platform's std::tm has
+	std::tm first, second;
+	std::memset(&first, 0xAB, sizeof(first));
+	std::memset(&second, 0x5C, sizeof(second));
+	for( auto time: { &first, &second } ) {
+			time->tm_sec   = 59;
+			time->tm_min   = 30;
+			time->tm_hour  = 23;
+			time->tm_mday  = 31;
+			time->tm_mon   = 11;
+			time->tm_year  = 99;
+			time->tm_wday  = 5;
+			time->tm_yday  = 364;
+			time->tm_isdst = 0;
+		}
+	static constexpr std::string_view fmt { "{:%Y-%m-%d %H:%M:%S %a %j}" };
+	ArgRecord firstRecord(fmt, first);
+	ArgRecord secondRecord(fmt, second);
+	REQUIRE(firstRecord.Bytes().size() == formatter::msg_details::AF_RECORD_HEADER_SIZE + 1 + 9 * sizeof(int));
+	REQUIRE(std::ranges::equal(firstRecord.Bytes(), secondRecord.Bytes()));
+
+	std::tm replayed;
+	std::memset(&replayed, 0xFF, sizeof(replayed));
+	REQUIRE(firstRecord.View().ForEachArg([ & ](const auto& arg, formatter::msg_details::SpecType) {
+		if constexpr( std::is_same_v<std::remove_cvref_t<decltype(arg)>, std::tm> ) replayed = arg;
+	}));
+	REQUIRE(replayed.tm_year == 99);
+	REQUIRE(replayed.tm_yday == 364);
+	REQUIRE(replayed.tm_isdst == 0);
+	std::tm standardOnly {};
+	std::memcpy(&standardOnly, &replayed, sizeof(int) * 9);
+	// everything past the standard fields comes back zeroed rather than as whatever the capturing side had
+	REQUIRE(std::memcmp(&replayed, &standardOnly, sizeof(std::tm)) == 0);
+	REQUIRE(formatter.format_record(firstRecord.View()) == formatter.format(fmt, first));
+}
+
+TEST_CASE("Deferred Record Owns Its String Arguments") {
+	ArgFormatter formatter;
+	std::string mutableArg { "captured value" };
+	ArgRecord record("{} and {}", mutableArg, 5);
+	mutableArg.assign("something else entirely");
+	REQUIRE(formatter.format_record(record.View()) == "captured value and 5");
+}
+
+TEST_CASE("Deferred Record Can Be Recaptured") {
+	ArgFormatter formatter;
+	ArgRecord record;
+	for( int i { 0 }; i < 10; ++i ) {
+			record.Capture("{}:{}", i, std::string(static_cast<size_t>(i), 'x'));
+			REQUIRE(record.Bytes().size() == ArgRecord::EncodedSize("{}:{}", i, std::string(static_cast<size_t>(i), 'x')));
+			REQUIRE(record.View().size() == record.Bytes().size());
+			REQUIRE(formatter.format_record(record.View()) == formatter.format("{}:{}", i, std::string(static_cast<size_t>(i), 'x')));
+		}
+}
+
+TEST_CASE("Record Ring Buffer Wraps Around In Order") {
+	ArgFormatter formatter;
+	// small enough that the records below wrap around the buffer many times
+	RecordRingBuffer ring(256);
+	REQUIRE(ring.Capacity() == 256);
+	REQUIRE_FALSE(ring.Push("{}", std::string(ring.Capacity(), 'x')));
+	std::vector<std::string> drained;
+	for( int i { 0 }; i < 200; ++i ) {
+			REQUIRE(ring.Push("{}-{}", i, std::string(static_cast<size_t>(i % 40), 'z')));
+			ring.Drain([ & ](const ArgRecordView& view) { drained.push_back(formatter.format_record(view)); });
+		}
+	REQUIRE(ring.Drain([](const ArgRecordView&) {}) == 0);
+	REQUIRE(drained.size() == 200);
+	for( int i { 0 }; i < 200; ++i ) {
+			REQUIRE(drained[ static_cast<size_t>(i) ] == formatter.format("{}-{}", i, std::string(static_cast<size_t>(i % 40), 'z')));
+		}
+}
+
+TEST_CASE("Record Ring Buffer Keeps Every Producer's Records") {
+	constexpr size_t producers { 4 };
+	constexpr size_t perProducer { 20'000 };
+	ArgFormatter formatter;
+	RecordRingBuffer ring(4096);
+	std::vector<std::thread> threads;
+	for( size_t p { 0 }; p < producers; ++p ) {
+			threads.emplace_back([ &ring, p ]() {
+				for( size_t i { 0 }; i < perProducer; ++i ) {
+						ring.Push("{} {} {}", p, i, "payload");
+					}
+			});
+		}
+	// every producer's sequence numbers have to come out in the order it pushed them
+	std::vector<size_t> next(producers, 0);
+	size_t total { 0 };
+	std::string line;
+	bool inOrder { true };
+	while( total < producers * perProducer ) {
+			total += ring.Drain([ & ](const ArgRecordView& view) {
+				line.clear();
+				formatter.format_record_to(std::back_inserter(line), view);
+				size_t producer { 0 }, seq { 0 };
+				std::sscanf(line.c_str(), "%zu %zu", &producer, &seq);
+				inOrder = inOrder && producer < producers && seq == next[ producer ]++ && line.ends_with(" payload");
+			});
+		}
+	for( auto& thread: threads ) thread.join();
+	REQUIRE(inOrder);
+	REQUIRE(ring.Drain([](const ArgRecordView&) {}) == 0);
+	for( auto count: next ) REQUIRE(count == perProducer);
+}
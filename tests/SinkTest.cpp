@@ -0,0 +1,201 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgSinks.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#if !defined(_WIN32)
+
+using namespace formatter::arg_formatter;
+
+static std::string ReadFileContents(const std::filesystem::path& path) {
+	std::ifstream file(path, std::ios::binary);
+	std::stringstream contents;
+	contents << file.rdbuf();
+	return contents.str();
+}
+
+static std::filesystem::path TempSinkPath(std::string_view name) {
+	return std::filesystem::temp_directory_path() / name;
+}
+
+TEST_CASE("Mapped File Sink Matches String Output") {
+	ArgFormatter formatter;
+	auto path { TempSinkPath("af_mapped_sink_test.txt") };
+	std::string expected;
+	{
+		formatter::sinks::MappedFileSink sink(path.string());
+		for( int i { 0 }; i < 100; ++i ) {
+				formatter.format_to(std::back_inserter(sink), "{},{:.3f},{},{}\n", i, i * 0.25, "row", 'c');
+				expected += formatter.format("{},{:.3f},{},{}\n", i, i * 0.25, "row", 'c');
+			}
+		REQUIRE(sink.size() == expected.size());
+		sink.Close();
+		REQUIRE_FALSE(sink.IsOpen());
+	}
+	// the file should have been truncated down to exactly what was written, not the size of the mapped region
+	REQUIRE(std::filesystem::file_size(path) == expected.size());
+	REQUIRE(ReadFileContents(path) == expected);
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Mapped File Sink Grows Past Initial Mapping") {
+	ArgFormatter formatter;
+	auto path { TempSinkPath("af_mapped_sink_growth_test.txt") };
+	std::string expected;
+	{
+		// a single page growth step forces several remaps over the course of the test
+		formatter::sinks::MappedFileSink sink(path.string(), 1);
+		for( int i { 0 }; i < 5000; ++i ) {
+				formatter.format_to(std::back_inserter(sink), "{:x}|{:_>10}|{}\n", i, "padded", i % 2 == 0);
+				expected += formatter.format("{:x}|{:_>10}|{}\n", i, "padded", i % 2 == 0);
+			}
+		// closing is left to the destructor here
+	}
+	REQUIRE(ReadFileContents(path) == expected);
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Mapped File Sink Reports Open Failure") {
+	REQUIRE_THROWS_AS(formatter::sinks::MappedFileSink("/nonexistent_af_dir/out.txt"), formatter::af_errors::error_handler::format_error);
+}
+
+TEST_CASE("File Sink Matches String Output") {
+	ArgFormatter formatter;
+	auto path { TempSinkPath("af_file_sink_test.txt") };
+	std::string expected;
+	{
+		// a tiny buffer exercises both the flush-on-full and the write-through paths
+		formatter::sinks::FileSink sink(path.string(), 16);
+		for( int i { 0 }; i < 1000; ++i ) {
+				formatter.format_to(std::back_inserter(sink), "[{}] {} {:.2f}\n", i, "a message longer than the sink buffer", i / 3.0);
+				expected += formatter.format("[{}] {} {:.2f}\n", i, "a message longer than the sink buffer", i / 3.0);
+			}
+		REQUIRE(sink.size() == expected.size());
+	}
+	REQUIRE(ReadFileContents(path) == expected);
+	std::filesystem::remove(path);
+}
+
+static std::string AsyncSinkRoundTrip(formatter::sinks::Backpressure policy, size_t messages, size_t bufferSize, size_t& dropped) {
+	ArgFormatter formatter;
+	auto path { TempSinkPath("af_async_sink_test.txt") };
+	{
+		formatter::sinks::AsyncFileSink sink(path.string(), bufferSize, policy);
+		for( size_t i { 0 }; i < messages; ++i ) {
+				formatter.format_to(std::back_inserter(sink), "message {:_>6} {}\n", i, "payload-payload-payload");
+				sink.Commit();
+			}
+		sink.Flush();
+		dropped = sink.DroppedCount();
+		sink.Close();
+	}
+	auto contents { ReadFileContents(path) };
+	std::filesystem::remove(path);
+	return contents;
+}
+
+TEST_CASE("Async File Sink Reports Open Failure") {
+	REQUIRE_THROWS_AS(formatter::sinks::AsyncFileSink("/nonexistent_af_dir/out.txt"), formatter::af_errors::error_handler::format_error);
+}
+
+TEST_CASE("Async File Sink Writes Every Message In Order") {
+	ArgFormatter formatter;
+	std::string expected;
+	for( size_t i { 0 }; i < 20000; ++i ) {
+			expected += formatter.format("message {:_>6} {}\n", i, "payload-payload-payload");
+		}
+	for( auto policy : { formatter::sinks::Backpressure::Block, formatter::sinks::Backpressure::Grow } ) {
+			size_t dropped { 0 };
+			REQUIRE(AsyncSinkRoundTrip(policy, 20000, 256, dropped) == expected);
+			REQUIRE(dropped == 0);
+		}
+}
+
+TEST_CASE("Async File Sink Only Drops Whole Messages") {
+	size_t dropped { 0 };
+	auto contents { AsyncSinkRoundTrip(formatter::sinks::Backpressure::Drop, 20000, 256, dropped) };
+	std::string_view view { contents };
+	size_t lines { 0 };
+	for( auto end { view.find('\n') }; end != std::string_view::npos; end = view.find('\n') ) {
+			// every line that made it to the file must be complete
+			REQUIRE(end == std::string_view("message _____0 payload-payload-payload").size());
+			view.remove_prefix(end + 1);
+			++lines;
+		}
+	REQUIRE(view.empty());
+	REQUIRE(lines + dropped == 20000);
+}
+
+TEST_CASE("Async File Sink Writes Messages Committed During A Write Without A Flush") {
+	ArgFormatter formatter;
+	auto path { TempSinkPath("af_async_sink_quiet_test.txt") };
+	// a first message large enough that the writer is still busy with it when the rest are committed
+	std::string bulk(32 * 1024 * 1024, 'b');
+	std::string expected;
+	formatter::sinks::AsyncFileSink sink(path.string(), bulk.size());
+	sink.append(bulk.data(), bulk.size());
+	sink.Commit();
+	for( int i { 0 }; i < 3; ++i ) {
+			formatter.format_to(std::back_inserter(sink), "last words {}\n", i);
+			expected += formatter.format("last words {}\n", i);
+			sink.Commit();
+		}
+	// no Flush(), Close() or further writes; the writer has to pick the trailing messages up on its own
+	auto deadline { std::chrono::steady_clock::now() + std::chrono::seconds(10) };
+	while( std::filesystem::file_size(path) < bulk.size() + expected.size() && std::chrono::steady_clock::now() < deadline ) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+	auto contents { ReadFileContents(path) };
+	REQUIRE(contents.size() == bulk.size() + expected.size());
+	REQUIRE(std::string_view(contents).substr(bulk.size()) == expected);
+	sink.Close();
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("Scatter Gather Sink References Caller Owned Text") {
+	ArgFormatter formatter;
+	std::string payload(200, 'p');
+	std::string_view header { "a header that is long enough to be referenced rather than copied" };
+	formatter::sinks::ScatterGatherSink sink;
+	formatter.format_to(std::back_inserter(sink), "{} | id={:_>8} | {} | {:.1f}\n", header, 42, payload, 2.5);
+	auto expected { formatter.format("{} | id={:_>8} | {} | {:.1f}\n", header, 42, payload, 2.5) };
+	REQUIRE(sink.size() == expected.size());
+
+	std::string gathered;
+	bool headerReferenced { false }, payloadReferenced { false };
+	for( const auto& vec: sink.IoVecs() ) {
+			headerReferenced |= vec.iov_base == header.data();
+			payloadReferenced |= vec.iov_base == payload.data();
+			gathered.append(static_cast<const char*>(vec.iov_base), vec.iov_len);
+		}
+	REQUIRE(headerReferenced);
+	REQUIRE(payloadReferenced);
+	REQUIRE(gathered == expected);
+}
+
+TEST_CASE("Scatter Gather Sink Writes Every Segment") {
+	ArgFormatter formatter;
+	auto path { TempSinkPath("af_scatter_gather_sink_test.txt") };
+	std::string payload(100, 'q');
+	std::string expected;
+	formatter::sinks::ScatterGatherSink sink(1);
+	// enough segments to need more than one writev() batch
+	for( int i { 0 }; i < 2000; ++i ) {
+			formatter.format_to(std::back_inserter(sink), "{} {} {}\n", i, payload, std::string_view(payload).substr(0, i % 50));
+			expected += formatter.format("{} {} {}\n", i, payload, std::string_view(payload).substr(0, i % 50));
+		}
+	auto fd { ::open(path.string().c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) };
+	REQUIRE(fd != -1);
+	sink.WriteTo(fd);
+	::close(fd);
+	REQUIRE(ReadFileContents(path) == expected);
+	sink.Clear();
+	REQUIRE(sink.size() == 0);
+	REQUIRE(sink.IoVecs().empty());
+	std::filesystem::remove(path);
+}
+
+#endif    // !_WIN32
@@ -0,0 +1,76 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgFormatter.h"
+
+// A code point at a time, with none of the block widening, as the reference for the transcoder
+template<typename Unit> static std::basic_string<Unit> TranscodeReference(std::string_view text) {
+	std::basic_string<Unit> units;
+	for( size_t pos { 0 }; pos < text.size(); ) {
+			char32_t codePoint {};
+			auto length { formatter::unicode::DecodeUtf8(text.substr(pos), codePoint) };
+			if( length == 0 ) {
+					codePoint = 0xFFFD;
+					length    = 1;
+			}
+			pos += length;
+			if( sizeof(Unit) == 2 && codePoint >= 0x10000 ) {
+					units += static_cast<Unit>(0xD800 + ((codePoint - 0x10000) >> 10));
+					units += static_cast<Unit>(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+			} else {
+					units += static_cast<Unit>(codePoint);
+				}
+		}
+	return units;
+}
+
+TEST_CASE("Transcoding: UTF-8 Is Widened To UTF-16 And UTF-32 Containers") {
+	std::u16string u16;
+	formatter::format_to(std::back_inserter(u16), "{} costs {}\xE2\x82\xAC", std::string_view { "caf\xC3\xA9" }, 42);
+	REQUIRE(u16 == u"café costs 42€");
+	std::u32string u32;
+	formatter::format_to(std::back_inserter(u32), "{} costs {}\xE2\x82\xAC", std::string_view { "caf\xC3\xA9" }, 42);
+	REQUIRE(u32 == U"café costs 42€");
+	std::vector<char16_t> u16Vector;
+	formatter::format_to(std::back_inserter(u16Vector), "[{:_^7}]", std::string_view { "\xE4\xB8\xAD" });
+	REQUIRE(std::u16string(u16Vector.begin(), u16Vector.end()) == u"[__中___]");
+	// code points outside the BMP are written as surrogate pairs in UTF-16 and as-is in UTF-32
+	u16.clear();
+	u32.clear();
+	formatter::format_to(std::back_inserter(u16), "{}", std::string_view { "\xF0\x9F\x98\x80!" });
+	formatter::format_to(std::back_inserter(u32), "{}", std::string_view { "\xF0\x9F\x98\x80!" });
+	REQUIRE(u16 == u"\xD83D\xDE00!");
+	REQUIRE(u32 == U"\U0001F600!");
+}
+
+TEST_CASE("Transcoding: Only The Requested Part Of A Value Is Written") {
+	std::u16string u16;
+	formatter::format_to(std::back_inserter(u16), "{:.3}|{}|{:.2}", std::string_view { "abcdef" }, 7, std::string("\xE4\xB8\xAD\xE6\x96\x87"));
+	REQUIRE(u16 == u"abc|7|中");
+	std::u32string u32;
+	formatter::format_to(std::back_inserter(u32), "{:_>5}|{}", 12, 'x');
+	REQUIRE(u32 == U"___12|x");
+}
+
+TEST_CASE("Transcoding: Ill-Formed UTF-8 Becomes The Replacement Character") {
+	std::u16string u16;
+	formatter::format_to(std::back_inserter(u16), "{}", std::string_view { "a\xFF" "b\xE4\xB8" "c\xED\xA0\x80" });
+	REQUIRE(u16 == TranscodeReference<char16_t>("a\xFF" "b\xE4\xB8" "c\xED\xA0\x80"));
+	REQUIRE(u16 == u"a�b��c���");
+}
+
+TEST_CASE("Transcoding: Matches The Reference At Every Position") {
+	// each multi-byte sequence is placed on and around the edges of the 16 and 32 char blocks of the vectorized widening
+	std::string text(80, 'a');
+	for( std::string_view sequence: { "\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "\x80", "\xF0\x9F" } ) {
+			for( size_t pos: { 0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 77 } ) {
+					auto copy { text };
+					copy.replace(pos, sequence.size(), sequence);
+					std::u16string u16;
+					std::u32string u32;
+					formatter::format_to(std::back_inserter(u16), "{}", copy);
+					formatter::format_to(std::back_inserter(u32), "{}", copy);
+					REQUIRE(u16 == TranscodeReference<char16_t>(copy));
+					REQUIRE(u32 == TranscodeReference<char32_t>(copy));
+				}
+		}
+}
@@ -0,0 +1,70 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgFormatter.h"
+
+TEST_CASE("Display Width: ASCII Text Pads And Truncates By Its Size") {
+	REQUIRE(formatter::format("[{:6}]", std::string_view { "ab" }) == "[ab    ]");
+	REQUIRE(formatter::format("[{:_<6}]", std::string_view { "ab" }) == "[ab____]");
+	REQUIRE(formatter::format("[{:_>6}]", std::string_view { "ab" }) == "[____ab]");
+	REQUIRE(formatter::format("[{:_^6}]", std::string_view { "ab" }) == "[__ab__]");
+	// the fill is worked out from the truncated text rather than the whole argument
+	REQUIRE(formatter::format("[{:_^7.3}]", std::string_view { "abcdef" }) == "[__abc__]");
+	REQUIRE(formatter::format("[{:_>6.4}]", std::string_view { "hello" }) == "[__hell]");
+	REQUIRE(formatter::format("[{:.2}]", std::string_view { "abc" }) == "[ab]");
+	REQUIRE(formatter::format("[{:.9}]", std::string_view { "abc" }) == "[abc]");
+	REQUIRE(formatter::format("[{:.9}]", std::string("abc")) == "[abc]");
+}
+
+TEST_CASE("Display Width: Wide Characters Take Two Columns") {
+	// U+4E2D, U+6587 (CJK), U+AC00 (Hangul) and U+FF21 (fullwidth 'A') are all East Asian Wide or Fullwidth
+	REQUIRE(formatter::format("[{:_<6}]", std::string_view { "\xE4\xB8\xAD" }) == "[\xE4\xB8\xAD____]");
+	REQUIRE(formatter::format("[{:_>6}]", std::string_view { "\xE4\xB8\xAD\xE6\x96\x87" }) == "[__\xE4\xB8\xAD\xE6\x96\x87]");
+	REQUIRE(formatter::format("[{:_^6}]", std::string("\xEA\xB0\x80")) == "[__\xEA\xB0\x80__]");
+	REQUIRE(formatter::format("[{:_<4}]", "a\xEF\xBC\xA1") == "[a\xEF\xBC\xA1_]");
+	// a wide character that doesn't fit in the precision is dropped rather than split
+	REQUIRE(formatter::format("[{:.3}]", std::string_view { "\xE4\xB8\xAD\xE6\x96\x87" }) == "[\xE4\xB8\xAD]");
+	REQUIRE(formatter::format("[{:_<5.3}]", std::string_view { "\xE4\xB8\xAD\xE6\x96\x87" }) == "[\xE4\xB8\xAD___]");
+	REQUIRE(formatter::format("[{:.1}]", std::string_view { "\xE4\xB8\xAD" }) == "[]");
+}
+
+TEST_CASE("Display Width: Combining Marks And Zero Width Characters Take No Columns") {
+	// 'e' followed by U+0301 (combining acute accent), U+200B (zero width space) and a precomposed U+00E9
+	REQUIRE(formatter::format("[{:_<4}]", std::string_view { "e\xCC\x81" }) == "[e\xCC\x81___]");
+	REQUIRE(formatter::format("[{:_>3}]", std::string_view { "a\xE2\x80\x8B" "b" }) == "[_a\xE2\x80\x8B" "b]");
+	REQUIRE(formatter::format("[{:_^5}]", std::string_view { "\xC3\xA9" }) == "[__\xC3\xA9__]");
+	// the mark belongs to the code point before it, so it's kept along with it
+	REQUIRE(formatter::format("[{:.1}]", std::string_view { "e\xCC\x81x" }) == "[e\xCC\x81]");
+}
+
+TEST_CASE("Display Width: Combining Marks From Every Script Take No Columns") {
+	// U+0E01 + U+0E31 (Thai), U+0995 + U+0981 (Bengali), U+0915 + U+093A (Devanagari) and U+0C95 + U+0CBF (Kannada)
+	REQUIRE(formatter::format("[{:_<3}]", std::string_view { "\xE0\xB8\x81\xE0\xB8\xB1" }) == "[\xE0\xB8\x81\xE0\xB8\xB1__]");
+	REQUIRE(formatter::format("[{:_>3}]", std::string_view { "\xE0\xA6\x95\xE0\xA6\x81" }) == "[__\xE0\xA6\x95\xE0\xA6\x81]");
+	REQUIRE(formatter::format("[{:_^4}]", std::string_view { "\xE0\xA4\x95\xE0\xA4\xBA" }) == "[_\xE0\xA4\x95\xE0\xA4\xBA__]");
+	REQUIRE(formatter::format("[{:.1}]", std::string_view { "\xE0\xB2\x95\xE0\xB2\xBFx" }) == "[\xE0\xB2\x95\xE0\xB2\xBF]");
+	REQUIRE(formatter::unicode::CodePointWidth(0x0E31) == 0);
+	REQUIRE(formatter::unicode::CodePointWidth(0x0981) == 0);
+	REQUIRE(formatter::unicode::CodePointWidth(0x093A) == 0);
+	REQUIRE(formatter::unicode::CodePointWidth(0x1E2AE) == 0);
+	// spacing marks (General_Category Mc) that aren't Grapheme_Extend still take a column, like U+0903 (Devanagari visarga)
+	REQUIRE(formatter::unicode::CodePointWidth(0x0903) == 1);
+}
+
+TEST_CASE("Display Width: Escaped Text Is Measured The Same Way") {
+	REQUIRE(formatter::format("[{:_<6j}]", std::string_view { "\xE4\xB8\xAD\"" }) == "[\xE4\xB8\xAD\\\"__]");
+	REQUIRE(formatter::format("[{:_>6?}]", std::string_view { "\xE4\xB8\xAD" }) == "[__\"\xE4\xB8\xAD\"]");
+}
+
+TEST_CASE("Display Width: Non-ASCII Text Anywhere Across The Vectorized Scan") {
+	// the first non-ASCII byte is found in 16 and 32 char blocks, so the wide character is placed on and around the block edges
+	for( size_t pos: { 0, 1, 15, 16, 17, 31, 32, 33, 47, 63, 64 } ) {
+			auto text { std::string(pos, 'a') + "\xE4\xB8\xAD" + std::string(6, 'b') };
+			auto columns { pos + 2 + 6 };
+			auto padded { "{:_<" + std::to_string(columns + 4) + "}" };
+			auto beforeWide { "{:." + std::to_string(pos + 1) + "}" };
+			auto withWide { "{:." + std::to_string(pos + 2) + "}" };
+			REQUIRE(formatter::format(std::string_view(padded), text) == text + "____");
+			REQUIRE(formatter::format(std::string_view(beforeWide), text) == std::string(pos, 'a'));
+			REQUIRE(formatter::format(std::string_view(withWide), text) == text.substr(0, pos + 3));
+		}
+}
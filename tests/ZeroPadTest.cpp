@@ -0,0 +1,102 @@
+#include "catch.hpp"
+
+#include "../include/ArgFormatter/ArgFormatter.h"
+
+TEST_CASE("Zero Padding: Zeros Go After The Sign And Base Prefix") {
+	REQUIRE(formatter::format("{:08}", 5) == "00000005");
+	REQUIRE(formatter::format("{:08}", -5) == "-0000005");
+	REQUIRE(formatter::format("{:+08}", 5) == "+0000005");
+	REQUIRE(formatter::format("{:+08}", -5) == "-0000005");
+	REQUIRE(formatter::format("{: 08}", 5) == " 0000005");
+	REQUIRE(formatter::format("{:08x}", 255) == "000000ff");
+	REQUIRE(formatter::format("{:08X}", 255u) == "000000FF");
+	REQUIRE(formatter::format("{:#010x}", 255) == "0x000000ff");
+	REQUIRE(formatter::format("{:#010X}", 255LL) == "0X000000FF");
+	REQUIRE(formatter::format("{:#010b}", 5) == "0b00000101");
+	REQUIRE(formatter::format("{:#08o}", 8) == "00000010");
+	REQUIRE(formatter::format("{:#010x}", -255) == "-0x00000ff");
+	REQUIRE(formatter::format("{:+#010x}", 255ULL) == "+0x00000ff");
+	REQUIRE(formatter::format("{:020}", std::numeric_limits<long long>::min()) == "-9223372036854775808");
+	REQUIRE(formatter::format("{:022}", std::numeric_limits<long long>::min()) == "-009223372036854775808");
+	REQUIRE(formatter::format("{:020}", std::numeric_limits<unsigned long long>::max()) == "18446744073709551615");
+	// a value already wider than the field is written as is
+	REQUIRE(formatter::format("{:03}", 123456) == "123456");
+	REQUIRE(formatter::format("{:0}", 7) == "7");
+}
+
+TEST_CASE("Zero Padding: Digit Counts At Every Boundary") {
+	unsigned long long value { 1 };
+	for( int digits { 1 }; digits <= 19; ++digits, value *= 10 ) {
+			for( auto v: { value - 1, value, value + 1 } ) {
+					auto text { std::to_string(v) };
+					auto expected { std::string(24 - text.size(), '0') + text };
+					REQUIRE(formatter::format("{:024}", v) == expected);
+				}
+		}
+	for( unsigned shift { 0 }; shift < 64; ++shift ) {
+			auto v { 1ULL << shift };
+			char hex[ 17 ] {}, bin[ 65 ] {};
+			std::to_chars(hex, hex + 16, v, 16);
+			std::to_chars(bin, bin + 64, v, 2);
+			REQUIRE(formatter::format("{:016x}", v) == std::string(16 - std::strlen(hex), '0') + hex);
+			REQUIRE(formatter::format("{:064b}", v) == std::string(64 - std::strlen(bin), '0') + bin);
+		}
+}
+
+TEST_CASE("Zero Padding: Floats, Pointers And Integer Presentations Of Bools And Chars") {
+	REQUIRE(formatter::format("{:08.2f}", 3.14159) == "00003.14");
+	REQUIRE(formatter::format("{:08.2f}", -3.14159) == "-0003.14");
+	REQUIRE(formatter::format("{:+08.2f}", 3.14159) == "+0003.14");
+	REQUIRE(formatter::format("{:+08.2f}", -3.14159) == "-0003.14");
+	REQUIRE(formatter::format("{:010e}", 1.5f) == "1.500000e+00");
+	// infinities and NaNs are padded with spaces instead
+	REQUIRE(formatter::format("{:06}", std::numeric_limits<double>::infinity()) == "   inf");
+	REQUIRE(formatter::format("{:06}", -std::numeric_limits<double>::infinity()) == "  -inf");
+	REQUIRE(formatter::format("{:06}", std::numeric_limits<double>::quiet_NaN()) == "   nan");
+	REQUIRE(formatter::format("{:018}", reinterpret_cast<const void*>(0x1234)) == "0x0000000000001234");
+	REQUIRE(formatter::format("{:04d}", true) == "0001");
+	REQUIRE(formatter::format("{:04x}", 'A') == "0041");
+	// bools and chars that aren't presented as numbers are aligned with spaces
+	REQUIRE(formatter::format("[{:06}]", true) == "[true  ]");
+	REQUIRE(formatter::format("[{:03}]", 'A') == "[A  ]");
+}
+
+TEST_CASE("Zero Padding: An Explicit Alignment Turns The '0' Flag Off") {
+	REQUIRE(formatter::format("[{:<06}]", 42) == "[42    ]");
+	REQUIRE(formatter::format("[{:>06}]", 42) == "[    42]");
+	REQUIRE(formatter::format("[{:*^06}]", 42) == "[**42**]");
+	REQUIRE(formatter::format("[{:6}]", 42) == "[    42]");
+}
+
+TEST_CASE("Zero Padding: Every Container Gets The Same Output") {
+	std::string expected { "id=-0x0000beef|" };
+	std::string asString;
+	std::vector<char> asVector;
+	std::u16string asU16;
+	std::u32string asU32;
+	formatter::format_to(std::back_inserter(asString), "id={:#011x}|", -0xbeef);
+	formatter::format_to(std::back_inserter(asVector), "id={:#011x}|", -0xbeef);
+	formatter::format_to(std::back_inserter(asU16), "id={:#011x}|", -0xbeef);
+	formatter::format_to(std::back_inserter(asU32), "id={:#011x}|", -0xbeef);
+	REQUIRE(asString == expected);
+	REQUIRE(std::string(asVector.begin(), asVector.end()) == expected);
+	REQUIRE(asU16 == std::u16string(expected.begin(), expected.end()));
+	REQUIRE(asU32 == std::u32string(expected.begin(), expected.end()));
+	// fields wider than the fill buffer
+	auto wide { "{:0" + std::to_string(1000) + "}" };
+	REQUIRE(formatter::format(std::string_view(wide), -42) == "-" + std::string(997, '0') + "42");
+	std::u16string wideU16;
+	formatter::format_to(std::back_inserter(wideU16), std::string_view(wide), -42);
+	auto wideExpected { "-" + std::string(997, '0') + "42" };
+	REQUIRE(wideU16 == std::u16string(wideExpected.begin(), wideExpected.end()));
+}
+
+TEST_CASE("Zero Padding: A Staged Value Doesn't Pick Up The Prefix Of An Earlier One") {
+	formatter::arg_formatter::ArgFormatter f;
+	std::u16string asU16;
+	f.format_to(std::back_inserter(asU16), "[{:#x}|{:08}|{:08}]", 255, 0, 0.0);
+	REQUIRE(asU16 == u"[0xff|00000000|00000000]");
+	asU16.clear();
+	f.format_to(std::back_inserter(asU16), "[{:+#x}|{:08}|{:08.1f}]", 255, -1, -2.5);
+	REQUIRE(asU16 == u"[+0xff|-0000001|-00002.5]");
+}
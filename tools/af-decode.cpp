@@ -0,0 +1,47 @@
+#include <ArgFormatter/ArgBinaryLog.h>
+
+#include <cstdio>
+#include <cstring>
+
+// Turns a binary log written by BinaryLogWriter back into text using the same formatting engine that would have produced it directly
+static void PrintUsage(const char* exe) {
+	std::fprintf(stderr, "Usage: %s [--timestamps] <binary log>\n", exe);
+}
+
+int main(int argc, char** argv) {
+	bool timestamps { false };
+	const char* path { nullptr };
+	for( int i { 1 }; i < argc; ++i ) {
+			if( std::strcmp(argv[ i ], "--timestamps") == 0 ) {
+					timestamps = true;
+			} else if( path == nullptr ) {
+					path = argv[ i ];
+			} else {
+					PrintUsage(argv[ 0 ]);
+					return 1;
+				}
+		}
+	if( path == nullptr ) {
+			PrintUsage(argv[ 0 ]);
+			return 1;
+	}
+
+	try {
+		formatter::binary_log::BinaryLogReader reader(path);
+		formatter::arg_formatter::ArgFormatter formatter;
+		std::string line;
+		reader.ForEachRecord([ & ](uint64_t timestamp, const formatter::msg_details::ArgRecordView& record) {
+			line.clear();
+			if( timestamps ) formatter.format_to(std::back_inserter(line), "[{}] ", timestamp);
+			formatter.format_record_to(std::back_inserter(line), record);
+			// records are written out exactly as formatted; only a record that doesn't end its own line gets one added
+			if( line.empty() || line.back() != '\n' ) line.push_back('\n');
+			std::fwrite(line.data(), 1, line.size(), stdout);
+		});
+	}
+	catch( const std::exception& e ) {
+		std::fprintf(stderr, "af-decode: %s: %s\n", path, e.what());
+		return 1;
+	}
+	return 0;
+}